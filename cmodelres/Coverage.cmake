@@ -0,0 +1,46 @@
+# Links cmodel.c with the fuzzer harness, and instruments it for gcov.
+# If the model was generated with --line-markers, then all counts are attributed
+# to lines of the original Solidity source.
+add_executable(covtest ${EXE_SRCS_COMMON} ${EXE_SRCS_CPP} libverify/verify_libfuzzer.cpp)
+target_link_libraries(covtest -fsanitize=fuzzer --coverage)
+set_target_properties(covtest PROPERTIES COMPILE_FLAGS "-g -O0 -fsanitize=fuzzer --coverage -DMC_LOG_LEVEL=0")
+
+# Locates a gcov implementation which understands the notes emitted by clang.
+find_program(
+    LLVM_COV_EXE
+    NAMES "llvm-cov-10" "llvm-cov"
+    DOC "Path to llvm-cov executable"
+)
+
+if(LLVM_COV_EXE)
+    message(STATUS "llvm-cov found: ${LLVM_COV_EXE}")
+    set(GCOV_CMD ${LLVM_COV_EXE} gcov)
+else()
+    find_program(GCOV_EXE NAMES gcov)
+    message(WARNING "llvm-cov not found, falling back to: ${GCOV_EXE}")
+    set(GCOV_CMD ${GCOV_EXE})
+endif()
+
+# Adds a command to generate the coverage directory.
+# This is where the per-file reports (*.gcov) are written.
+set(COVERAGE_DIR "coverage_dir")
+set(COVERAGE_DIR_FULL "${CMAKE_BINARY_DIR}/${COVERAGE_DIR}")
+add_custom_command(
+    OUTPUT ${COVERAGE_DIR}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${COVERAGE_DIR_FULL}
+)
+
+# User-facing command to replay the fuzzing corpus once, and then report the
+# number of times each line was executed. Counts are reset on each run.
+set(COVTEST_OBJ "${CMAKE_BINARY_DIR}/CMakeFiles/covtest.dir/cmodel.cpp.o")
+set(COVTEST_DATA "${CMAKE_BINARY_DIR}/CMakeFiles/covtest.dir/cmodel.cpp.gcda")
+add_custom_target(
+    coverage
+    COMMAND ${CMAKE_COMMAND} -E remove -f ${COVTEST_DATA}
+    COMMAND "${CMAKE_BINARY_DIR}/covtest" ${CORPUS_DIR_FULL} -runs=0
+    COMMAND ${GCOV_CMD} -p -o ${COVTEST_OBJ} "${CMAKE_BINARY_DIR}/cmodel.cpp"
+    WORKING_DIRECTORY ${COVERAGE_DIR_FULL}
+    DEPENDS ${CORPUS_DIR} ${COVERAGE_DIR}
+    COMMAND_EXPAND_LISTS
+)
+add_dependencies(coverage covtest)
@@ -0,0 +1,27 @@
+# Links cmodel.c with the explicit-state runtime. Each input is drawn from a
+# small domain, and all reachable states are searched across several threads.
+# The runtime requires the stdint integer model.
+if(INT_MODEL STREQUAL "USE_STDINT")
+    find_package(Threads REQUIRED)
+
+    set(EXPLICIT_FLAGS "-O2 -DMC_LOG_LEVEL=0 -DMC_STATE_HASH -DMC_EXPLICIT_STATE")
+    add_executable(ecmodel ${EXE_SRCS_COMMON} ${EXE_HARNESSED_CPP} libverify/verify_explicit.cpp)
+    target_link_libraries(ecmodel Threads::Threads ${Boost_PROGRAM_OPTIONS_LIBRARIES})
+    set_target_properties(ecmodel PROPERTIES COMPILE_FLAGS ${EXPLICIT_FLAGS})
+
+    # User-facing command to search the model. The arguments are forwarded to
+    # ecmodel (see ecmodel --help). A counterexample is written to CEX_TRACE, so
+    # that it can be minimized and replayed by icmodel.
+    set(
+        EXPLORE_ARGS
+        "--depth=4;--values=2"
+        CACHE STRING
+        "Arguments to ecmodel, as used by the explore target."
+    )
+    add_custom_target(
+        explore
+        COMMAND ecmodel ${EXPLORE_ARGS} --cex=${CEX_TRACE}
+        DEPENDS ecmodel
+        COMMAND_EXPAND_LISTS
+    )
+endif()
@@ -1,3 +1,17 @@
 # A simple target to build the interactive model.
 add_executable(icmodel ${EXE_SRCS_COMMON} ${EXE_HARNESSED_CPP})
 target_link_libraries(icmodel verify_interactive)
+
+# Minimizes a trace of icmodel which violates an assertion. The minimized trace
+# violates the same assertion, and is printed to stdout.
+set(
+    CEX_TRACE
+    "${CMAKE_BINARY_DIR}/cex.txt"
+    CACHE FILEPATH
+    "A trace of icmodel which violates an assertion"
+)
+add_custom_target(
+    minimize
+    COMMAND icmodel --minimize=${CEX_TRACE}
+    DEPENDS icmodel
+)
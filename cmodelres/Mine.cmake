@@ -0,0 +1,23 @@
+# Links cmodel.c with the fuzzer harness and the invariant miner. Replaying the
+# corpus reports a snapshot of the model after each transaction, from which
+# candidate invariants are written to invariants.h (see libverify/verify_mine).
+# The miner requires the stdint integer model.
+if(INT_MODEL STREQUAL "USE_STDINT")
+    set(INVARIANTS_FILE "${CMAKE_CURRENT_SOURCE_DIR}/invariants.h")
+
+    add_executable(minetest ${EXE_SRCS_COMMON} ${EXE_SRCS_CPP} libverify/verify_libfuzzer.cpp libverify/verify_mine.cpp)
+    target_link_libraries(minetest -fsanitize=fuzzer)
+    target_compile_definitions(minetest PRIVATE MC_INVARIANTS_FILE="${INVARIANTS_FILE}")
+    set_target_properties(minetest PROPERTIES COMPILE_FLAGS "-g -O1 -fsanitize=fuzzer -DMC_LOG_LEVEL=0 -DMC_MINE_INVARIANTS")
+
+    # User-facing command to replay the fuzzing corpus once, and then mine
+    # invariants from all states it reached. The lemmas are used by verify if
+    # cmake is passed -DSEA_USE_INVARIANTS=ON.
+    add_custom_target(
+        mine
+        COMMAND "${CMAKE_BINARY_DIR}/minetest" ${CORPUS_DIR_FULL} -runs=0
+        DEPENDS ${CORPUS_DIR}
+        BYPRODUCTS ${INVARIANTS_FILE}
+    )
+    add_dependencies(mine minetest)
+endif()
@@ -0,0 +1,118 @@
+# Optimized variants of the fuzzer harness. Each variant omits AddressSanitizer
+# and compiles out all logging. These variants trade diagnostics for speed, and
+# crashes found by these variants should be replayed through fuzztest.
+set(
+    MC_LTO
+    OFF
+    CACHE BOOL
+    "Enables link-time optimization for icmodel and the optimized fuzzers."
+)
+
+set(FUZZ_FAST_FLAGS "-O3 -g -fsanitize=fuzzer -DMC_LOG_LEVEL=0 -DMC_STATE_HASH")
+set(FUZZ_FAST_LINK "-fsanitize=fuzzer")
+if(MC_LTO)
+    set(FUZZ_FAST_FLAGS "${FUZZ_FAST_FLAGS} -flto")
+    set(FUZZ_FAST_LINK "${FUZZ_FAST_LINK} -flto")
+    set_property(TARGET icmodel APPEND_STRING PROPERTY COMPILE_FLAGS " -O3 -flto")
+    target_link_libraries(icmodel -flto)
+endif()
+
+set(FUZZ_SRCS ${EXE_SRCS_COMMON} ${EXE_SRCS_CPP} libverify/verify_libfuzzer.cpp)
+
+# The optimized fuzzer, without profile data.
+add_executable(fuzztest_fast ${FUZZ_SRCS})
+target_link_libraries(fuzztest_fast ${FUZZ_FAST_LINK})
+set_target_properties(fuzztest_fast PROPERTIES COMPILE_FLAGS ${FUZZ_FAST_FLAGS})
+
+# Locates llvm-profdata, as required to merge profiles.
+find_program(
+    LLVM_PROFDATA_EXE
+    NAMES "llvm-profdata-10" "llvm-profdata-mp-10" "llvm-profdata"
+    DOC "Path to llvm-profdata executable"
+)
+
+if(LLVM_PROFDATA_EXE)
+    message(STATUS "llvm-profdata found: ${LLVM_PROFDATA_EXE}")
+else()
+    message(WARNING "llvm-profdata not found, as required by fuzztest_pgo.")
+endif()
+
+# Two-stage profile-guided optimization. In the first stage, an instrumented
+# fuzzer replays the corpus recorded by `make fuzz`. In the second stage, the
+# optimized fuzzer is rebuilt from the merged profile. Running `make
+# fuzztest_pgo` performs both stages, so the profile always matches the corpus.
+if(LLVM_PROFDATA_EXE)
+    set(PGO_RAW "${CMAKE_BINARY_DIR}/pgo/fuzztest.profraw")
+    set(PGO_DATA "${CMAKE_BINARY_DIR}/pgo/fuzztest.profdata")
+    set(PGO_EXE "${CMAKE_BINARY_DIR}/pgo/fuzztest")
+
+    add_executable(fuzztest_instr ${FUZZ_SRCS})
+    target_link_libraries(
+        fuzztest_instr ${FUZZ_FAST_LINK} -fprofile-instr-generate
+    )
+    set_target_properties(
+        fuzztest_instr PROPERTIES
+        COMPILE_FLAGS "${FUZZ_FAST_FLAGS} -fprofile-instr-generate"
+    )
+
+    add_custom_target(
+        pgo_profile
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${CMAKE_BINARY_DIR}/pgo"
+        COMMAND ${CMAKE_COMMAND} -E remove -f ${PGO_RAW}
+        COMMAND ${CMAKE_COMMAND} -E env LLVM_PROFILE_FILE=${PGO_RAW}
+                "${CMAKE_BINARY_DIR}/fuzztest_instr" ${CORPUS_DIR_FULL} -runs=0
+        COMMAND ${LLVM_PROFDATA_EXE} merge -o ${PGO_DATA} ${PGO_RAW}
+        DEPENDS ${CORPUS_DIR}
+    )
+    add_dependencies(pgo_profile fuzztest_instr)
+
+    # The final stage is compiled directly, so that it is rebuilt whenever the
+    # profile changes.
+    string(REPLACE " " ";" PGO_FLAGS "${FUZZ_FAST_FLAGS} ${FUZZ_FAST_LINK}")
+    set(PGO_SRCS "")
+    foreach(fn ${EXE_SRCS_CPP})
+        list(APPEND PGO_SRCS "${fn}")
+    endforeach(fn)
+    list(
+        APPEND PGO_SRCS
+        "${CMAKE_CURRENT_SOURCE_DIR}/libverify/verify_libfuzzer.cpp"
+    )
+
+    add_custom_command(
+        OUTPUT ${PGO_EXE}
+        COMMAND ${CMAKE_CXX_COMPILER} -DMC_${INT_MODEL} ${PGO_FLAGS}
+                -fprofile-instr-use=${PGO_DATA}
+                -I${CMAKE_CURRENT_SOURCE_DIR} -I${PROJECT_BINARY_DIR}
+                ${PGO_SRCS} -o ${PGO_EXE}
+        DEPENDS ${PGO_DATA} ${PGO_SRCS}
+        COMMAND_EXPAND_LISTS
+    )
+    add_custom_target(fuzztest_pgo DEPENDS ${PGO_EXE})
+    add_dependencies(fuzztest_pgo pgo_profile)
+endif()
+
+# User-facing command to compare the throughput of each fuzzer. Each variant is
+# seeded by the recorded corpus, and runs the same number of inputs.
+set(BENCH_RUNS "100000" CACHE STRING "The number of inputs run by make bench.")
+
+set(BENCH_EXES "${CMAKE_BINARY_DIR}/fuzztest")
+list(APPEND BENCH_EXES "${CMAKE_BINARY_DIR}/fuzztest_fast")
+if(LLVM_PROFDATA_EXE)
+    list(APPEND BENCH_EXES ${PGO_EXE})
+endif()
+string(REPLACE ";" "," BENCH_EXES_ARG "${BENCH_EXES}")
+
+add_custom_target(
+    bench
+    COMMAND ${CMAKE_COMMAND}
+            -DBENCH_EXES=${BENCH_EXES_ARG}
+            -DBENCH_CORPUS=${CORPUS_DIR_FULL}
+            -DBENCH_SCRATCH=${CMAKE_BINARY_DIR}/bench_dir
+            -DBENCH_RUNS=${BENCH_RUNS}
+            -P "${MC_CMAKE_DIR}/RunBench.cmake"
+    DEPENDS ${CORPUS_DIR}
+)
+add_dependencies(bench fuzztest fuzztest_fast)
+if(LLVM_PROFDATA_EXE)
+    add_dependencies(bench fuzztest_pgo)
+endif()
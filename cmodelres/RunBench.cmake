@@ -0,0 +1,31 @@
+# Reports the executions per second of each fuzzer in BENCH_EXES. This script is
+# invoked by the bench target, and expects the following definitions.
+# BENCH_EXES: a comma-separated list of fuzzers.
+# BENCH_CORPUS: the corpus used to seed each fuzzer. It is never modified.
+# BENCH_SCRATCH: a directory used to store inputs found while benchmarking.
+# BENCH_RUNS: the number of inputs run by each fuzzer.
+string(REPLACE "," ";" BENCH_EXES "${BENCH_EXES}")
+
+foreach(exe ${BENCH_EXES})
+    # New inputs are written to the first corpus directory, so the recorded
+    # corpus is passed second.
+    file(REMOVE_RECURSE ${BENCH_SCRATCH})
+    file(MAKE_DIRECTORY ${BENCH_SCRATCH})
+
+    execute_process(
+        COMMAND ${exe} ${BENCH_SCRATCH} ${BENCH_CORPUS}
+                -runs=${BENCH_RUNS} -seed=1 -print_final_stats=1
+        OUTPUT_VARIABLE bench_out
+        ERROR_VARIABLE bench_out
+        RESULT_VARIABLE bench_res
+    )
+
+    string(REGEX MATCH "average_exec_per_sec: *([0-9]+)" stat "${bench_out}")
+    if(stat)
+        message(STATUS "${exe}: ${CMAKE_MATCH_1} execs/sec")
+    else()
+        message(STATUS "${exe}: no statistics (exit code ${bench_res})")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${BENCH_SCRATCH})
@@ -0,0 +1,263 @@
+# Runs Seahorn on the model, and persists the invariants it infers between runs.
+# This script is invoked by the verify target, and expects the following
+# definitions.
+# SEA_CMD: the command line which invokes sea with --show-invars.
+# SEA_INPUTS: the list of files read by sea.
+# SEA_INVARS_DIR: a directory in which invariants are stored between runs.
+# SEA_REUSE_INVARS: if true, stored invariants seed the next run.
+#
+# Invariants are written to SEA_INVARS_DIR/<function>.inv, with one line per
+# block (i.e., per loop header or function summary). The result of each
+# safe run is stored under a fingerprint of its inputs. If a later run has
+# the same fingerprint, the stored result is reported without solving again.
+# As results are kept for every fingerprint, reverting an edit reuses the result
+# from before the edit.
+#
+# The invariants of main are also translated into C, and are written to
+# SEA_INVARS_DIR/sea_lemmas.h as SOL_SEA_LEMMAS. A variable of an invariant is
+# traced to contract state if its name, less its function prefix and numeric
+# suffixes, is the path of a state word observed by the model (for example,
+# main@%contract_0.user_total.0 is traced to contract_0.user_total). Each
+# conjunct over other variables, or over operations without a C form, is
+# dropped. The lemmas of each block are joined by disjunction, so they hold at
+# the transaction loop if the invariant of its header is among them. The next
+# run then assumes the lemmas before each transaction, and checks them after
+# each transaction (see MC_USE_SEA_LEMMAS). If that run is not safe, then the
+# lemmas may be stale, and so the run is repeated without them.
+cmake_policy(SET CMP0054 NEW)
+
+set(RESULT_DIR "${SEA_INVARS_DIR}/results")
+set(LEMMA_FILE "${SEA_INVARS_DIR}/sea_lemmas.h")
+
+# Computes a fingerprint of the command line and all inputs. Stored lemmas are
+# checked by the run which assumes them, and so are not part of the fingerprint.
+string(SHA256 fingerprint "${SEA_CMD}")
+foreach(fn ${SEA_INPUTS})
+    if(NOT EXISTS ${fn})
+        message(FATAL_ERROR "Missing input to sea: ${fn}")
+    endif()
+    file(SHA256 ${fn} fn_hash)
+    string(SHA256 fingerprint "${fingerprint}${fn_hash}")
+endforeach()
+set(RESULT_FILE "${RESULT_DIR}/${fingerprint}.txt")
+
+# Reuses the previous result if the model is unchanged.
+if(EXISTS ${RESULT_FILE})
+    file(READ ${RESULT_FILE} last_result)
+    message(STATUS "Model unchanged since last run, reusing result.")
+    execute_process(COMMAND ${CMAKE_COMMAND} -E echo "${last_result}")
+    return()
+endif()
+
+# Runs sea, optionally with the stored lemmas, and sets sea_out.
+function(run_sea _use_lemmas)
+    set(cmd ${SEA_CMD})
+    if(_use_lemmas)
+        list(APPEND cmd "-DMC_USE_SEA_LEMMAS" "-I${SEA_INVARS_DIR}")
+    endif()
+    execute_process(
+        COMMAND ${cmd}
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE out
+        RESULT_VARIABLE res
+    )
+    if(NOT res EQUAL 0)
+        execute_process(COMMAND ${CMAKE_COMMAND} -E echo "${out}")
+        message(FATAL_ERROR "sea failed with exit code ${res}")
+    endif()
+    set(sea_out "${out}" PARENT_SCOPE)
+endfunction()
+
+set(use_lemmas FALSE)
+if(SEA_REUSE_INVARS AND EXISTS ${LEMMA_FILE})
+    set(use_lemmas TRUE)
+    message(STATUS "Assuming the lemmas of ${LEMMA_FILE}.")
+endif()
+run_sea(${use_lemmas})
+if(use_lemmas AND NOT sea_out MATCHES "(^|\n)unsat")
+    message(STATUS "Stored lemmas may be stale, retrying without them.")
+    file(REMOVE ${LEMMA_FILE})
+    run_sea(FALSE)
+endif()
+execute_process(COMMAND ${CMAKE_COMMAND} -E echo "${sea_out}")
+
+# Invariants are only reported for safe models. A sat result leaves the stored
+# invariants unchanged, so that they are available once the model is repaired.
+if(NOT sea_out MATCHES "(^|\n)unsat")
+    return()
+endif()
+
+# Splits the invariants by function. Each function is introduced by a line of
+# the form "Function: <name>", and is followed by lines "<block>: <formula>".
+file(GLOB stored_invars "${SEA_INVARS_DIR}/*.inv")
+if(stored_invars)
+    file(REMOVE ${stored_invars})
+endif()
+string(REPLACE ";" "\\;" sea_lines "${sea_out}")
+string(REPLACE "\n" ";" sea_lines "${sea_lines}")
+set(fn_name "")
+set(fn_invars "")
+foreach(line ${sea_lines} "Function: ")
+    if(line MATCHES "^Function: *(.*)$")
+        if(fn_name)
+            file(WRITE "${SEA_INVARS_DIR}/${fn_name}.inv" "${fn_invars}")
+        endif()
+        string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_1}" fn_name)
+        set(fn_invars "")
+    elseif(fn_name AND line MATCHES "^[ \t]*[^ \t:]+:")
+        string(STRIP "${line}" line)
+        string(APPEND fn_invars "${line}\n")
+    endif()
+endforeach()
+
+file(WRITE ${RESULT_FILE} "${sea_out}")
+
+# -------------------------------------------------------------------------- #
+
+# Translates the term of SEA_TOKENS which starts at index ${_pos} into C. Sets
+# _pos to the index after the term, _c to its C form, and _ok to FALSE if the
+# term has no C form.
+function(sea_term _pos _c _ok)
+    set(ok TRUE)
+    set(c "")
+    set(at ${${_pos}})
+    list(GET SEA_TOKENS ${at} tok)
+    math(EXPR at "${at} + 1")
+
+    if(tok STREQUAL "(")
+        list(GET SEA_TOKENS ${at} op)
+        math(EXPR at "${at} + 1")
+        set(args "")
+        list(GET SEA_TOKENS ${at} next)
+        while(NOT next STREQUAL ")")
+            sea_term(at arg arg_ok)
+            if(NOT arg_ok)
+                set(ok FALSE)
+            endif()
+            list(APPEND args "${arg}")
+            list(GET SEA_TOKENS ${at} next)
+        endwhile()
+        math(EXPR at "${at} + 1")
+
+        list(LENGTH args argc)
+        if(op STREQUAL "not" AND argc EQUAL 1)
+            set(c "(!${args})")
+        elseif(op STREQUAL "-" AND argc EQUAL 1)
+            set(c "(-${args})")
+        elseif(argc LESS 2)
+            set(ok FALSE)
+        elseif(op STREQUAL "and")
+            string(REPLACE ";" " && " c "(${args})")
+        elseif(op STREQUAL "or")
+            string(REPLACE ";" " || " c "(${args})")
+        elseif(op MATCHES "^(\\+|-|\\*)$")
+            string(REPLACE ";" " ${op} " c "(${args})")
+        elseif(op MATCHES "^(=|<=|>=|<|>)$" AND argc EQUAL 2)
+            if(op STREQUAL "=")
+                set(op "==")
+            endif()
+            string(REPLACE ";" " ${op} " c "(${args})")
+        else()
+            set(ok FALSE)
+        endif()
+    elseif(tok STREQUAL "true")
+        set(c "1")
+    elseif(tok STREQUAL "false")
+        set(c "0")
+    elseif(tok MATCHES "^[0-9]+$")
+        set(c "${tok}")
+    else()
+        # Strips the function prefix, the value sigil and numeric suffixes.
+        string(REGEX REPLACE "^[^@]*@" "" var "${tok}")
+        string(REGEX REPLACE "^[%@]" "" var "${var}")
+        string(REGEX REPLACE "(\\.[0-9]+)+$" "" var "${var}")
+        string(MAKE_C_IDENTIFIER "${var}" key)
+        if(DEFINED SEA_STATE_${key})
+            set(c "((__int128)(${SEA_STATE_${key}}))")
+        else()
+            set(ok FALSE)
+        endif()
+    endif()
+
+    set(${_pos} ${at} PARENT_SCOPE)
+    set(${_c} "${c}" PARENT_SCOPE)
+    set(${_ok} ${ok} PARENT_SCOPE)
+endfunction()
+
+# Maps the path of each state word observed by the model to its C expression.
+set(model_src "")
+foreach(fn ${SEA_INPUTS})
+    get_filename_component(fn_base ${fn} NAME)
+    if(fn_base STREQUAL "cmodel.c")
+        file(READ ${fn} model_src)
+    endif()
+endforeach()
+string(REGEX MATCHALL "SOL_OBSERVE\\(\"[^\"]*\"" labels "${model_src}")
+foreach(label ${labels})
+    string(REGEX REPLACE "^SOL_OBSERVE\\(\"(.*)\"$" "\\1" expr "${label}")
+    string(REGEX MATCHALL "[A-Za-z_][A-Za-z0-9_]*" path "${expr}")
+    list(REMOVE_AT path -1)
+    string(REPLACE ";" "." path "${path}")
+    string(MAKE_C_IDENTIFIER "${path}" key)
+    set(SEA_STATE_${key} "${expr}")
+endforeach()
+
+# Translates the invariant of each block of main into a conjunction of lemmas.
+set(block_lemmas "")
+set(main_invars "")
+if(EXISTS "${SEA_INVARS_DIR}/main.inv")
+    file(STRINGS "${SEA_INVARS_DIR}/main.inv" main_invars)
+endif()
+foreach(line ${main_invars})
+    string(REGEX REPLACE "^[^:]*:[ \t]*" "" formula "${line}")
+    string(REPLACE ";" "#" formula "${formula}")
+    string(REGEX MATCHALL "[()]|[^ \t()]+" SEA_TOKENS "${formula}")
+    list(LENGTH SEA_TOKENS token_ct)
+    if(token_ct EQUAL 0)
+        continue()
+    endif()
+
+    # Splits a top-level conjunction, so that each conjunct is kept or dropped
+    # on its own.
+    set(conjuncts "")
+    set(at 0)
+    list(GET SEA_TOKENS 0 first)
+    if(first STREQUAL "(" AND token_ct GREATER 1)
+        list(GET SEA_TOKENS 1 op)
+        if(op STREQUAL "and")
+            set(at 2)
+            list(GET SEA_TOKENS ${at} next)
+            while(NOT next STREQUAL ")")
+                sea_term(at c ok)
+                if(ok AND NOT c STREQUAL "1")
+                    list(APPEND conjuncts "${c}")
+                endif()
+                list(GET SEA_TOKENS ${at} next)
+            endwhile()
+            set(at -1)
+        endif()
+    endif()
+    if(at EQUAL 0)
+        sea_term(at c ok)
+        if(ok AND NOT c STREQUAL "1")
+            list(APPEND conjuncts "${c}")
+        endif()
+    endif()
+
+    if(conjuncts)
+        string(REPLACE ";" " && " lemma "(${conjuncts})")
+        list(APPEND block_lemmas "${lemma}")
+    endif()
+endforeach()
+
+if(block_lemmas)
+    string(REPLACE ";" " \\\n    || " lemmas "${block_lemmas}")
+    file(
+        WRITE ${LEMMA_FILE}
+        "// Lemmas translated from the invariants of the last safe run of sea.\n"
+        "#define SOL_SEA_LEMMAS (0 \\\n    || ${lemmas})\n"
+    )
+    message(STATUS "Stored lemmas for the next run in ${LEMMA_FILE}.")
+else()
+    file(REMOVE ${LEMMA_FILE})
+endif()
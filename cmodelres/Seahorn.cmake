@@ -47,6 +47,12 @@ foreach(d ${CMODEL_COMPILE_DEFS_RAW})
 endforeach(d)
 list(APPEND CMODEL_COMPILE_DEFS "-DMC_USE_EXTERNAL_NONDET")
 
+# Optionally seeds the proof with the lemmas of invariants.h (see make mine).
+option(SEA_USE_INVARIANTS "Assume and check the lemmas of invariants.h." OFF)
+if(SEA_USE_INVARIANTS)
+    list(APPEND CMODEL_COMPILE_DEFS "-DMC_USE_INVARIANTS")
+endif()
+
 # Sets solver mode.
 set(HORN_SOLVER_LIA "lia")
 set(HORN_SOLVER_NLIA "nlia")
@@ -75,6 +81,15 @@ list(APPEND SEA_CEX_YAMA "-y" "${CEX_YAML}")
 # Handles additional arguments, if provided.
 set(SEA_ARGS "" CACHE STRING "Additional arguments to pass to Seahorn.")
 
+# Configures where verify stores invariants and results between runs.
+set(
+    SEA_INVARS_DIR
+    "${CMAKE_BINARY_DIR}/sea_invars"
+    CACHE PATH
+    "The directory in which invariants are stored between runs of verify."
+)
+option(SEA_REUSE_INVARS "Assume and check the invariants stored by verify." ON)
+
 # If all dependancies were located, adds all Seahorn targets.
 if(SEA_EXE)
     # Merges arguments to sea.
@@ -106,11 +121,34 @@ if(SEA_EXE)
         )
     endif()
 
+    # Invariants are persisted between runs of verify (see RunSea.cmake).
+    # The headers included by the model are also inputs of sea.
+    set(VERIFY_CMD ${SEA_EXE} yama ${SEA_COMMON_YAMA} pf ${SEAHORN_DEPS} ${SEA_FULL_ARGS} --show-invars)
+    file(
+        GLOB VERIFY_HEADERS
+        "${CMAKE_CURRENT_SOURCE_DIR}/*.h"
+        "${CMAKE_CURRENT_SOURCE_DIR}/libverify/*.h"
+    )
+    set(VERIFY_INPUTS ${SEAHORN_DEPS} ${VERIFY_HEADERS})
+    if(SEA_USE_INVARIANTS)
+        list(APPEND VERIFY_INPUTS "${CMAKE_CURRENT_SOURCE_DIR}/invariants.h")
+    endif()
+    foreach(arg ${SEA_COMMON_YAMA})
+        if(NOT arg STREQUAL "-y")
+            list(APPEND VERIFY_INPUTS ${arg})
+        endif()
+    endforeach(arg)
+    list(REMOVE_DUPLICATES VERIFY_INPUTS)
     add_custom_target(
         verify
-        COMMAND ${SEA_EXE} yama ${SEA_COMMON_YAMA} pf ${SEAHORN_DEPS} ${SEA_FULL_ARGS} --show-invars
+        COMMAND ${CMAKE_COMMAND}
+                "-DSEA_CMD=${VERIFY_CMD}"
+                "-DSEA_INPUTS=${VERIFY_INPUTS}"
+                "-DSEA_INVARS_DIR=${SEA_INVARS_DIR}"
+                "-DSEA_REUSE_INVARS=${SEA_REUSE_INVARS}"
+                -P "${MC_CMAKE_DIR}/RunSea.cmake"
         SOURCES ${SEAHORN_DEPS}
-        COMMAND_EXPAND_LISTS
+        VERBATIM
     )
     add_custom_target(
         cex
@@ -0,0 +1,28 @@
+# Links cmodel.c with the random-walk runtime. Each run draws its inputs from a
+# seeded pseudorandom generator, and runs are split across several threads. As
+# the runtime does not rely on libFuzzer, it builds with any C++ compiler. The
+# runtime requires the stdint integer model.
+if(INT_MODEL STREQUAL "USE_STDINT")
+    find_package(Threads REQUIRED)
+
+    set(SIMULATE_FLAGS "-O2 -DMC_LOG_LEVEL=0 -DMC_RANDOM_WALK")
+    add_executable(rcmodel ${EXE_SRCS_COMMON} ${EXE_HARNESSED_CPP} libverify/verify_random.cpp)
+    target_link_libraries(rcmodel Threads::Threads ${Boost_PROGRAM_OPTIONS_LIBRARIES})
+    set_target_properties(rcmodel PROPERTIES COMPILE_FLAGS ${SIMULATE_FLAGS})
+
+    # User-facing command to simulate the model. The arguments are forwarded to
+    # rcmodel (see rcmodel --help). A counterexample is written to CEX_TRACE, so
+    # that it can be minimized and replayed by icmodel.
+    set(
+        SIMULATE_ARGS
+        "--runs=1000000;--depth=8"
+        CACHE STRING
+        "Arguments to rcmodel, as used by the simulate target."
+    )
+    add_custom_target(
+        simulate
+        COMMAND rcmodel ${SIMULATE_ARGS} --cex=${CEX_TRACE}
+        DEPENDS rcmodel
+        COMMAND_EXPAND_LISTS
+    )
+endif()
@@ -179,6 +179,13 @@ MapIndexSummary::MapIndexSummary(
 {
 }
 
+MapIndexSummary::MapIndexSummary(
+    MapIndexSummary const& _base, uint64_t _clients
+): MapIndexSummary(_base)
+{
+    m_client_reps = _clients;
+}
+
 void MapIndexSummary::extract_literals(ContractDefinition const& _src)
 {
     // Skips interfaces which do not add functions or variables.
@@ -102,6 +102,10 @@ public:
     // Generates map indices for use by the number of _clients and _contracts.
     // If _concrete, then interference values are omitted.
     MapIndexSummary(bool _concrete, uint64_t _clients, uint64_t _contracts);
+
+    // Reuses the analysis of _base, but with the number of clients reset to
+    // _clients. None of the literal or interference data depends on _clients.
+    MapIndexSummary(MapIndexSummary const& _base, uint64_t _clients);
     
     // A first-pass analysis which inspects contract code and extracts literals.
     void extract_literals(ContractDefinition const& _src);
@@ -213,21 +213,21 @@ AllocationGraph::AllocationGraph(vector<ContractDefinition const*> _model)
         m_violations.splice(m_violations.end(), violations);
 
         // Checks that each contract variable has only one possible type.
-        m_vertices[contract] = {};
+        auto & vertex = m_vertices[*contract];
         for (auto child : summary.children())
         {
-            auto typedata = m_truetypes.find(child.dest);
-            if (typedata == m_truetypes.end())
+            auto const* TYPEDATA = m_truetypes.find(*child.dest);
+            if (!TYPEDATA)
             {
                 // Caches the first "true type" for the contract.
-                m_truetypes[child.dest] = child.type;
-                m_vertices[contract].push_back(move(child));
+                m_truetypes[*child.dest] = child.type;
                 _model.push_back(child.type);
+                vertex.push_back(move(child));
             }
-            else if (typedata->second == child.type)
+            else if (*TYPEDATA == child.type)
             {
                 // Two statements initialize the contract as a consistent type.
-                m_vertices[contract].push_back(move(child));
+                vertex.push_back(move(child));
             }
             else
             {
@@ -239,27 +239,26 @@ AllocationGraph::AllocationGraph(vector<ContractDefinition const*> _model)
     }
 
     // Computes cost of each vertex.
-    for (auto itr = m_vertices.begin(); itr != m_vertices.end(); ++itr)
-    {
-        analyze(itr->first, itr->second);
-    }
+    m_vertices.for_each([this](ASTNode const& _node, auto const& _children) {
+        analyze(dynamic_cast<Label>(&_node), _children);
+    });
 }
 
 size_t AllocationGraph::cost_of(Label _vertex) const
 {
-    auto itr = m_reach.find(_vertex);
-    if (itr != m_reach.end()) return itr->second;
+    auto const* COST = m_reach.find(*_vertex);
+    if (COST) return *COST;
     return 0;
 }
 
 AllocationSummary::CallGroup AllocationGraph::children_of(Label _vertex) const
 {
-    auto itr = m_vertices.find(_vertex);
-    if (itr == m_vertices.end())
+    auto const* CHILDREN = m_vertices.find(*_vertex);
+    if (!CHILDREN)
     {
         throw runtime_error("Unable to find contract: " + _vertex->name());
     }
-    return itr->second;
+    return *CHILDREN;
 }
 
 AllocationSummary::CallGroup AllocationGraph::violations() const
@@ -269,36 +268,36 @@ AllocationSummary::CallGroup AllocationGraph::violations() const
 
 bool AllocationGraph::retval_is_allocated(VariableDeclaration const& _var) const
 {
-    auto itr = m_truetypes.find(&_var);
-    return ((itr != m_truetypes.end()) && (itr->second != nullptr));
+    auto const* TYPE = m_truetypes.find(_var);
+    return (TYPE && (*TYPE != nullptr));
 }
 
 ContractDefinition const&
     AllocationGraph::specialize(VariableDeclaration const& _var) const
 {
-    auto itr = m_truetypes.find(&_var);
-    if ((itr == m_truetypes.end()) || (itr->second == nullptr))
+    auto const* TYPE = m_truetypes.find(_var);
+    if (!TYPE || (*TYPE == nullptr))
     {
         throw runtime_error("Unable to find declaration: " + _var.name());
     }
-    return (*itr->second);
+    return (**TYPE);
 }
 
 void AllocationGraph::analyze(
     Label _root, AllocationSummary::CallGroup _children
 )
 {
-    if (m_reach.find(_root) != m_reach.end()) return;
+    if (m_reach.contains(*_root)) return;
 
     size_t cost = 1;
     for (auto child : _children)
     {
-        auto grandchildren = m_vertices.find(child.type)->second;
+        auto grandchildren = *m_vertices.find(*child.type);
         analyze(child.type, grandchildren);
-        cost += m_reach[child.type];
+        cost += *m_reach.find(*child.type);
     }
 
-    m_reach[_root] = cost;
+    m_reach[*_root] = cost;
 }
 
 // -------------------------------------------------------------------------- //
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <libsolidity/ast/ASTVisitor.h>
+#include <libsolidity/modelcheck/utils/NodeTable.h>
 
 #include <list>
 #include <map>
@@ -151,9 +152,9 @@ public:
     ContractDefinition const& specialize(VariableDeclaration const& _var) const;
 
 private:
-    using VarTyping = std::map<VariableDeclaration const*, Label>;
-    using Graph = std::map<Label, AllocationSummary::CallGroup>;
-    using Reach = std::map<Label, size_t>;
+    using VarTyping = NodeTable<Label>;
+    using Graph = NodeTable<AllocationSummary::CallGroup>;
+    using Reach = NodeTable<size_t>;
 
     // Computes and caches the cost of constructing each neighbour. Cost is
     // defined as the number of instantiated constracts
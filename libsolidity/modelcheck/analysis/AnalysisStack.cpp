@@ -2,6 +2,7 @@
 
 #include <libsolidity/modelcheck/analysis/AbstractAddressDomain.h>
 #include <libsolidity/modelcheck/analysis/AllocationSites.h>
+#include <libsolidity/modelcheck/analysis/BitWidth.h>
 #include <libsolidity/modelcheck/analysis/CallGraph.h>
 #include <libsolidity/modelcheck/analysis/CallState.h>
 #include <libsolidity/modelcheck/analysis/ContractRvAnalysis.h>
@@ -9,6 +10,8 @@
 #include <libsolidity/modelcheck/analysis/Library.h>
 #include <libsolidity/modelcheck/analysis/TypeNames.h>
 
+#include <list>
+#include <set>
 #include <stdexcept>
 
 using namespace std;
@@ -141,6 +144,13 @@ FlatAddressAnalysis::FlatAddressAnalysis(
 	}
 }
 
+FlatAddressAnalysis::FlatAddressAnalysis(
+	FlatAddressAnalysis const& _base, size_t _clients
+): LibraryAnalysis(_base)
+{
+	m_addresses = make_shared<MapIndexSummary>(*_base.m_addresses, _clients);
+}
+
 shared_ptr<MapIndexSummary const> FlatAddressAnalysis::addresses() const
 {
 	return m_addresses;
@@ -153,10 +163,18 @@ AnalysisStack::AnalysisStack(
 	std::vector<SourceUnit const*> _full,
 	size_t _clients,
 	bool _concrete_clients,
-	bool _escalates_reqs
+	bool _escalates_reqs,
+	bool _narrow_ints,
+	OverflowChecks _overflow,
+	bool _use_env,
+	bool _global_state
 ): FlatAddressAnalysis(_model, _full, _clients, _concrete_clients)
+ , m_overflow(_overflow)
+ , m_global_state(_global_state)
 {
-	m_environment = make_shared<CallState>(*calls(), _escalates_reqs);
+	m_environment = make_shared<CallState>(
+		*calls(), _escalates_reqs, _use_env
+	);
 	m_types = make_shared<TypeAnalyzer>();
 
 	// TODO: deprecate.
@@ -164,6 +182,70 @@ AnalysisStack::AnalysisStack(
 	{
 		m_types->record(*ast);
 	}
+
+	if (_narrow_ints)
+	{
+		BitWidthAnalyzer widths(*model());
+		for (auto const& entry : widths.narrowed())
+		{
+			m_types->narrow(*entry.first, entry.second);
+		}
+	}
+
+	// Ensures that each hoisted variable has at most one instance.
+	if (_global_state)
+	{
+		set<VariableDeclaration const*> hoisted;
+		list<shared_ptr<FlatContract const>> pending;
+		for (auto contract : model()->bundle()) pending.push_back(contract);
+		while (!pending.empty())
+		{
+			auto contract = pending.front();
+			pending.pop_front();
+
+			for (auto decl : contract->state_variables())
+			{
+				if (hoists(*decl) && !hoisted.insert(decl).second)
+				{
+					throw runtime_error(
+						"Global state requires one instance of " +
+						contract->name() + "::" + decl->name() + "."
+					);
+				}
+			}
+
+			// Shadowed variables share a field, but would not share a global.
+			set<string> names;
+			auto const* RAW = contract->raw();
+			for (auto base : RAW->annotation().linearizedBaseContracts)
+			{
+				for (auto decl : base->stateVariables())
+				{
+					if (hoists(*decl) && !names.insert(decl->name()).second)
+					{
+						throw runtime_error(
+							"Global state does not support shadowing of " +
+							contract->name() + "::" + decl->name() + "."
+						);
+					}
+				}
+			}
+
+			for (auto const& record : model()->children_of(*contract))
+			{
+				pending.push_back(record.child);
+			}
+		}
+	}
+}
+
+AnalysisStack::AnalysisStack(AnalysisStack const& _base, size_t _clients)
+ : FlatAddressAnalysis(_base, _clients)
+ , m_environment(_base.m_environment)
+ , m_types(_base.m_types)
+ , m_overflow(_base.m_overflow)
+ , m_global_state(_base.m_global_state)
+{
 }
 
 shared_ptr<CallState const> AnalysisStack::environment() const
@@ -176,6 +258,18 @@ shared_ptr<TypeAnalyzer const> AnalysisStack::types() const
 	return m_types;
 }
 
+OverflowChecks AnalysisStack::overflow_checks() const
+{
+	return m_overflow;
+}
+
+bool AnalysisStack::hoists(VariableDeclaration const& _decl) const
+{
+	if (!m_global_state || !_decl.isStateVariable()) return false;
+	if (_decl.isConstant()) return false;
+	return (_decl.annotation().type->category() != Type::Category::Contract);
+}
+
 
 // -------------------------------------------------------------------------- //
 
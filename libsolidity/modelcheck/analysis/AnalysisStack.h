@@ -17,6 +17,7 @@ namespace solidity
 {
 class ContractDefinition;
 class SourceUnit;
+class VariableDeclaration;
 }
 }
 
@@ -155,6 +156,11 @@ public:
         bool _concrete_clients
     );
 
+    // Reuses all analyses of _base, and re-parameterizes its address analysis
+    // with _clients. This avoids re-analyzing the bundle when only the number
+    // of clients changes.
+    FlatAddressAnalysis(FlatAddressAnalysis const& _base, size_t _clients);
+
     // Describes the address requirements of the bundle.
     std::shared_ptr<MapIndexSummary const> addresses() const;
 
@@ -164,6 +170,12 @@ private:
 
 // -------------------------------------------------------------------------- //
 
+/**
+ * Determines which arithmetic operations are lowered to overflow checks. With
+ * UNPROVEN, checks are elided for operations which provably cannot overflow.
+ */
+enum class OverflowChecks { NONE, ALL, UNPROVEN };
+
 /**
  * The final pass generates stand-alone modules such as the type translator and
  * the call state environment.
@@ -176,25 +188,50 @@ public:
     // contracts to encode. The _clients field gives the number of distinguished
     // clients, while _concrete_clients escalates all clients to a concrete
     // execution. The _escalates_reqs parameter will force all requirements to
-    // be escalated into assertions.
+    // be escalated into assertions. If _narrow_ints is set, then unsigned state
+    // variables are modeled with the minimal width given by BitWidthAnalyzer.
+    // The _overflow parameter selects which +, - and * operations are checked.
+    // If _use_env is set, then all transaction-level call state is passed
+    // through a shared sol_env structure. If _global_state is set, then state
+    // variables are hoisted out of their contracts, and into globals. This
+    // requires that each state variable is instantiated at most once.
     // TODO(scottwe): deprecate _full.
     AnalysisStack(
         InheritanceModel const& _model,
         std::vector<SourceUnit const*> _full,
         size_t _clients,
         bool _concrete_clients,
-        bool _escalates_reqs
+        bool _escalates_reqs,
+        bool _narrow_ints = false,
+        OverflowChecks _overflow = OverflowChecks::NONE,
+        bool _use_env = false,
+        bool _global_state = false
     );
 
+    // Equivalent to AnalysisStack(...) with the parameters used to build _base,
+    // except with _clients in place of the original client count. All analyses
+    // independent of the client count are shared with _base.
+    AnalysisStack(AnalysisStack const& _base, size_t _clients);
+
     // Characterizes the environment needed by each call.
     std::shared_ptr<CallState const> environment() const;
 
     // Returns the type analyzer.
     std::shared_ptr<TypeAnalyzer const> types() const;
 
+    // Returns which arithmetic operations should be checked for overflow.
+    OverflowChecks overflow_checks() const;
+
+    // Returns true if _decl is a state variable which is declared as a global
+    // of the model, rather than as a field of its contract. Contract variables
+    // are never hoisted, as they hold the addresses and balances of children.
+    bool hoists(VariableDeclaration const& _decl) const;
+
 private:
     std::shared_ptr<CallState> m_environment;
     std::shared_ptr<TypeAnalyzer> m_types;
+    OverflowChecks m_overflow;
+    bool m_global_state;
 };
 
 // -------------------------------------------------------------------------- //
@@ -0,0 +1,220 @@
+#include <libsolidity/modelcheck/analysis/BitWidth.h>
+
+#include <libsolidity/modelcheck/analysis/Inheritance.h>
+#include <libsolidity/modelcheck/utils/AST.h>
+#include <libsolidity/modelcheck/utils/Types.h>
+
+#include <list>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+
+// -------------------------------------------------------------------------- //
+
+BitWidthAnalyzer::BitWidthAnalyzer(FlatModel const& _model)
+{
+    // Pass 1: collects all code in the model, along with its state variables.
+    list<ContractDefinition const*> code;
+    for (auto contract : _model.view())
+    {
+        for (auto base : contract->raw()->annotation().linearizedBaseContracts)
+        {
+            if (m_visited.insert(base).second)
+            {
+                record_variables(*base);
+                code.push_back(base);
+            }
+        }
+    }
+
+    // Pass 2: bounds each variable by all writes within the model.
+    for (auto contract : code)
+    {
+        analyze(*contract);
+    }
+
+    for (auto const& entry : m_upper)
+    {
+        if (m_unbounded.find(entry.first) != m_unbounded.end()) continue;
+
+        auto const& TYPE = unwrap(*entry.first->type());
+        auto const DECL_BITS = dynamic_cast<IntegerType const&>(TYPE).numBits();
+
+        uint16_t bits = 8;
+        while (bits < DECL_BITS && (entry.second >> bits) != 0) bits += 8;
+
+        if (bits < DECL_BITS)
+        {
+            m_narrowed[entry.first] = bits;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+map<VariableDeclaration const*, uint16_t> const&
+    BitWidthAnalyzer::narrowed() const
+{
+    return m_narrowed;
+}
+
+// -------------------------------------------------------------------------- //
+
+bool BitWidthAnalyzer::visit(Assignment const& _node)
+{
+    auto const& LHS = ExpressionCleaner(_node.leftHandSide()).clean();
+    if (auto tuple = dynamic_cast<TupleExpression const*>(&LHS))
+    {
+        // Destructuring assignments are conservatively treated as unbounded.
+        for (auto component : tuple->components())
+        {
+            if (!component) continue;
+            if (auto var = candidate_of(*component))
+            {
+                record_write(*var, nullptr);
+            }
+        }
+    }
+    else if (auto var = candidate_of(LHS))
+    {
+        if (_node.assignmentOperator() == Token::Assign)
+        {
+            record_write(*var, &_node.rightHandSide());
+        }
+        else
+        {
+            record_write(*var, nullptr);
+        }
+    }
+    return true;
+}
+
+bool BitWidthAnalyzer::visit(UnaryOperation const& _node)
+{
+    // Note that delete resets a variable to 0, which is always in bounds.
+    if (TokenTraits::isCountOp(_node.getOperator()))
+    {
+        if (auto var = candidate_of(_node.subExpression()))
+        {
+            record_write(*var, nullptr);
+        }
+    }
+    return true;
+}
+
+// -------------------------------------------------------------------------- //
+
+void BitWidthAnalyzer::record_variables(ContractDefinition const& _contract)
+{
+    for (auto decl : _contract.stateVariables())
+    {
+        if (decl->isConstant()) continue;
+
+        auto const* TYPE = dynamic_cast<IntegerType const*>(
+            &unwrap(*decl->type())
+        );
+        if (!TYPE || TYPE->isSigned()) continue;
+
+        m_upper[decl] = 0;
+    }
+}
+
+void BitWidthAnalyzer::analyze(ContractDefinition const& _contract)
+{
+    for (auto decl : _contract.stateVariables())
+    {
+        if (decl->value() && m_upper.find(decl) != m_upper.end())
+        {
+            record_write(*decl, decl->value().get());
+        }
+    }
+
+    for (auto func : _contract.definedFunctions())
+    {
+        if (func->isImplemented()) func->body().accept(*this);
+    }
+
+    for (auto modifier : _contract.functionModifiers())
+    {
+        modifier->body().accept(*this);
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+VariableDeclaration const* BitWidthAnalyzer::candidate_of(
+    Expression const& _lhs
+) const
+{
+    auto decl = dynamic_cast<VariableDeclaration const*>(node_to_ref(_lhs));
+    if (decl && m_upper.find(decl) != m_upper.end()) return decl;
+    return nullptr;
+}
+
+// -------------------------------------------------------------------------- //
+
+void BitWidthAnalyzer::record_write(
+    VariableDeclaration const& _var, Expression const* _val
+)
+{
+    dev::u256 upper;
+    if (_val && bound_of(*_val, upper))
+    {
+        m_upper[&_var] = max(m_upper[&_var], upper);
+    }
+    else
+    {
+        m_unbounded.insert(&_var);
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+bool BitWidthAnalyzer::bound_of(Expression const& _expr, dev::u256& _upper)
+{
+    auto const& EXPR = ExpressionCleaner(_expr).clean();
+    if (auto lit = dynamic_cast<Literal const*>(&EXPR))
+    {
+        if (lit->token() != Token::Number) return false;
+
+        auto const* TYPE = lit->annotation().type;
+        auto const* RATIONAL = dynamic_cast<RationalNumberType const*>(TYPE);
+        if (!RATIONAL || RATIONAL->isFractional() || RATIONAL->isNegative())
+        {
+            return false;
+        }
+
+        _upper = TYPE->literalValue(lit);
+        return true;
+    }
+    else if (auto cond = dynamic_cast<Conditional const*>(&EXPR))
+    {
+        dev::u256 t_upper, f_upper;
+        if (!bound_of(cond->trueExpression(), t_upper)) return false;
+        if (!bound_of(cond->falseExpression(), f_upper)) return false;
+        _upper = max(t_upper, f_upper);
+        return true;
+    }
+    else if (auto id = dynamic_cast<Identifier const*>(&EXPR))
+    {
+        auto const* REF = id->annotation().referencedDeclaration;
+        auto const* VAR = dynamic_cast<VariableDeclaration const*>(REF);
+        if (VAR && VAR->isConstant() && VAR->value())
+        {
+            return bound_of(*VAR->value(), _upper);
+        }
+    }
+    return false;
+}
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
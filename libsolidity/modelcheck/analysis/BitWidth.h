@@ -0,0 +1,79 @@
+/**
+ * Every unsigned integer in Solidity is modeled at its declared width, even if
+ * it ranges over a small interval (counters bounded by literals, enum-like
+ * flags, etc). This file provides an interval analysis over the state variables
+ * of a flat model, which is used to narrow the C types of said variables.
+ *
+ * @date 2020
+ */
+
+#pragma once
+
+#include <libsolidity/ast/ASTVisitor.h>
+
+#include <map>
+#include <set>
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+
+class FlatModel;
+
+// -------------------------------------------------------------------------- //
+
+/**
+ * Computes an interval [0, hi] for each unsigned state variable in the model.
+ * The interval is bounded only if every write to the variable is a constant
+ * expression (literals, constants, and conditionals over such values). All
+ * other writes, such as arithmetic updates, widen the variable to its declared
+ * type. As every value stored is known statically, no truncation is possible
+ * and all assertions over the variable are preserved.
+ */
+class BitWidthAnalyzer : public ASTConstVisitor
+{
+public:
+    // Computes bounds for all unsigned state variables reachable from _model.
+    // This includes all code inherited by each contract.
+    explicit BitWidthAnalyzer(FlatModel const& _model);
+
+    // Returns all variables which fit in fewer bits than declared, along with
+    // their minimal width. All widths are a multiple of 8.
+    std::map<VariableDeclaration const*, uint16_t> const& narrowed() const;
+
+protected:
+    bool visit(Assignment const& _node) override;
+    bool visit(UnaryOperation const& _node) override;
+
+private:
+    std::set<ContractDefinition const*> m_visited;
+    std::map<VariableDeclaration const*, dev::u256> m_upper;
+    std::set<VariableDeclaration const*> m_unbounded;
+    std::map<VariableDeclaration const*, uint16_t> m_narrowed;
+
+    // Records all unsigned state variables of _contract as candidates.
+    void record_variables(ContractDefinition const& _contract);
+
+    // Bounds all candidates using the initializers and code of _contract.
+    void analyze(ContractDefinition const& _contract);
+
+    // Returns the candidate variable written to by _lhs, or nullptr if _lhs
+    // is not a candidate.
+    VariableDeclaration const* candidate_of(Expression const& _lhs) const;
+
+    // Widens _var by _val, or marks it as unbounded if _val is not constant.
+    void record_write(VariableDeclaration const& _var, Expression const* _val);
+
+    // If _expr is a constant expression, then _upper is set to its largest
+    // possible value and true is returned. Otherwise, false is returned.
+    static bool bound_of(Expression const& _expr, dev::u256& _upper);
+};
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
@@ -193,13 +193,17 @@ CallGraph::CallGraph(
     shared_ptr<FlatModel const> _model
 ): m_graph(CallGraphBuilder(_expr_resolver).build(_model)) {}
 
-CallGraph::CodeSet CallGraph::executed_code() const
+CallGraph::CodeSet const& CallGraph::executed_code() const
 {
     return m_graph->vertices();
 }
 
-CallGraph::CodeSet CallGraph::internals(FlatContract const& _scope) const
+CallGraph::CodeSet const&
+    CallGraph::internals(FlatContract const& _scope) const
 {
+    auto & cached = m_internals[*_scope.raw()];
+    if (cached) return *cached;
+
     CodeSet methods;
 
     // Computes list of all interfaces, including "special" methods.
@@ -213,7 +217,6 @@ CallGraph::CodeSet CallGraph::internals(FlatContract const& _scope) const
         functions.push_back(ctor);
     }
 
-    // TODO: precompute.
     set<FunctionDefinition const*> visited;
     for (auto itr = functions.begin(); itr != functions.end(); ++itr)
     {
@@ -224,7 +227,7 @@ CallGraph::CodeSet CallGraph::internals(FlatContract const& _scope) const
 
         for (auto succ : m_graph->neighbours(func))
         {
-            auto labels = m_graph->label_of(func, succ);
+            auto const& labels = m_graph->label_of(func, succ);
             if (labels.find(CallTypes::External) == labels.end())
             {
                 functions.push_back(succ);
@@ -232,7 +235,8 @@ CallGraph::CodeSet CallGraph::internals(FlatContract const& _scope) const
         }
     }
 
-    return methods;
+    cached = make_unique<CodeSet const>(move(methods));
+    return *cached;
 }
 
 CallGraph::CodeSet CallGraph::super_calls(
@@ -262,7 +266,7 @@ CallGraph::CodeSet CallGraph::super_calls(
 
         for (auto succ : m_graph->neighbours(func))
         {
-            auto labels = m_graph->label_of(func, succ);
+            auto const& labels = m_graph->label_of(func, succ);
             if (labels.find(CallTypes::External) == labels.end())
             {
                 functions.push_back(succ);
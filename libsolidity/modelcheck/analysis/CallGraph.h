@@ -7,11 +7,13 @@
 #pragma once
 
 #include <libsolidity/ast/ASTVisitor.h>
+#include <libsolidity/modelcheck/utils/NodeTable.h>
 
 #include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace dev
 {
@@ -88,22 +90,23 @@ public:
     }
 
     // Returns all vertices.
-    std::set<Vertex> vertices() const { return m_vertices; }
+    std::set<Vertex> const& vertices() const { return m_vertices; }
 
     // Returns the neighbours of a vertex.
-    std::set<Vertex> neighbours(Vertex _src) const
+    std::set<Vertex> const& neighbours(Vertex _src) const
     {
+        static std::set<Vertex> const NONE;
         auto match = m_edges.find(_src);
         if (match != m_edges.end())
         {
             return match->second;
         }
-        return {};
+        return NONE;
     }
 
 private:
     std::set<Vertex> m_vertices;
-    std::map<Vertex, std::set<Vertex>> m_edges;
+    std::unordered_map<Vertex, std::set<Vertex>> m_edges;
 };
 
 /**
@@ -122,9 +125,15 @@ public:
 
     // Returns the label from _src to _dst. If no edge exists, the default value
     // is returned.
-    std::set<Label> label_of(Vertex _src, Vertex _dst)
+    std::set<Label> const& label_of(Vertex _src, Vertex _dst) const
     {
-        return m_labels[std::make_pair(_src,_dst)];
+        static std::set<Label> const NONE;
+        auto match = m_labels.find(std::make_pair(_src, _dst));
+        if (match != m_labels.end())
+        {
+            return match->second;
+        }
+        return NONE;
     }
 
 private:
@@ -188,10 +197,11 @@ public:
     );
 
     // Returns all function vertices in the call graph.
-    CodeSet executed_code() const;
+    CodeSet const& executed_code() const;
 
-    // Returns all internal methods used by _scope.
-    CodeSet internals(FlatContract const& _scope) const;
+    // Returns all internal methods used by _scope. The result is computed on
+    // first use, and is then cached.
+    CodeSet const& internals(FlatContract const& _scope) const;
 
     // Returns all function definitions inherited by _scope, through _call. Note
     // that _call is included in this list.
@@ -201,6 +211,9 @@ public:
 
 private:
     std::shared_ptr<CallGraphBuilder::Graph> m_graph;
+
+    // Caches internals(), by contract.
+    mutable NodeTable<std::unique_ptr<CodeSet const>> m_internals;
 };
 
 // -------------------------------------------------------------------------- //
@@ -25,8 +25,9 @@ namespace modelcheck
 
 // -------------------------------------------------------------------------- //
 
-CallState::CallState(CallGraph const& _graph, bool _escalate_reqs)
- : m_escalates_reqs(_escalate_reqs)
+CallState::CallState(
+    CallGraph const& _graph, bool _escalate_reqs, bool _use_env
+): m_escalates_reqs(_escalate_reqs), m_uses_env(_use_env)
 {
     for (auto call : _graph.executed_code())
     {
@@ -64,12 +65,47 @@ list<CallState::FieldData> const& CallState::order() const
     return m_field_order;
 }
 
+CExprPtr CallState::get_field(CallStateUtilities::Field _field) const
+{
+    auto const NAME = CallStateUtilities::get_name(_field);
+    if (m_uses_env && CallStateUtilities::is_env_field(_field))
+    {
+        auto const ENV = CallStateUtilities::ENV_PARAM;
+        return make_shared<CIdentifier>(ENV, true)->access(NAME);
+    }
+    return make_shared<CIdentifier>(NAME, false);
+}
+
+CStructDef CallState::env_struct(bool _forward_declare) const
+{
+    shared_ptr<CParams> fields;
+    if (!_forward_declare)
+    {
+        fields = make_shared<CParams>();
+        for (auto const& fld : order())
+        {
+            if (!fld.in_env) continue;
+            fields->push_back(make_shared<CVarDecl>(fld.type_name, fld.name));
+        }
+    }
+    return CStructDef(CallStateUtilities::ENV_STRUCT, move(fields));
+}
+
 void CallState::push_state_to(CFuncCallBuilder & _builder) const
 {
-    CExprPtr sender;
+    if (m_uses_env)
+    {
+        auto const ENV = CallStateUtilities::ENV_PARAM;
+        _builder.push(make_shared<CIdentifier>(ENV, true));
+    }
+
     for (auto fld : order())
     {
-        if (fld.field == CallStateUtilities::Field::Origin)
+        if (fld.in_env)
+        {
+            continue;
+        }
+        else if (fld.field == CallStateUtilities::Field::Origin)
         {
             auto src_type = CallStateUtilities::Field::Sender;
             auto src_name = CallStateUtilities::get_name(src_type);
@@ -90,9 +126,16 @@ void CallState::compute_next_state_for(
 ) const
 {
 	auto self_id = make_shared<CIdentifier>("self", true);
+	if (m_uses_env && _for_contract)
+	{
+		auto const ENV = CallStateUtilities::ENV_PARAM;
+		_builder.push(make_shared<CIdentifier>(ENV, true));
+	}
+
 	for (auto const& f : order())
 	{
         if (!_for_contract && f.contract_only) continue;
+        if (f.in_env) continue;
 		if (_external && f.field == CallStateUtilities::Field::Sender)
 		{
 			string const ADDRESS = ContractUtilities::address_member();
@@ -133,6 +176,8 @@ bool CallState::uses_pay() const { return m_uses_pay; }
 
 bool CallState::escalate_requires() const { return m_escalates_reqs; }
 
+bool CallState::uses_env() const { return m_uses_env; }
+
 void CallState::endVisit(FunctionCall const& _node)
 {
     // The scan is in search of transfer and send which must be FunctionCall's.
@@ -162,6 +207,7 @@ void CallState::add_field(CallStateUtilities::Field _field)
     f.type = CallStateUtilities::get_type(_field);
     f.type_name = TypeAnalyzer::get_simple_ctype(*f.type);
     f.contract_only = CallStateUtilities::is_contract_only(_field);
+    f.in_env = m_uses_env && CallStateUtilities::is_env_field(_field);
     m_field_order.push_back(move(f));
 }
 
@@ -46,12 +46,16 @@ public:
         TypePointer type;
         std::string type_name;
         bool contract_only;
+        bool in_env;
     };
 
     // A sufficient state for each call is inferred from _graph. If the
     // _escalate_reqs flag is set, the call state will propogate the ReqFail
-    // flag will be propogated.
-    CallState(CallGraph const& _graph, bool _escalate_reqs);
+    // flag will be propogated. If _use_env is set, then all fields which are
+    // fixed for a transaction are passed together through a sol_env pointer.
+    CallState(
+        CallGraph const& _graph, bool _escalate_reqs, bool _use_env = false
+    );
 
     // Allows the CallState to pass dependencies to the primitive generator.
     void register_primitives(PrimitiveTypeGenerator& _gen) const;
@@ -59,6 +63,13 @@ public:
     // Returns the order of fields in use.
     std::list<FieldData> const& order() const;
 
+    // Returns an expression which evaluates to _field within a method body.
+    CExprPtr get_field(CallStateUtilities::Field _field) const;
+
+    // Returns the definition of the sol_env structure. If _forward_declare is
+    // set, then the fields are omitted.
+    CStructDef env_struct(bool _forward_declare) const;
+
     // Appends all argument ID's to an argument list, in order.
     void push_state_to(CFuncCallBuilder & _builder) const;
 
@@ -82,6 +93,9 @@ public:
     // Returns true if requires should be escalated to assertions.
     bool escalate_requires() const;
 
+    // Returns true if transaction-level fields are passed through sol_env.
+    bool uses_env() const;
+
 protected:
     void endVisit(FunctionCall const& _node) override;
 
@@ -94,6 +108,7 @@ private:
     bool m_uses_pay = false;
 
     bool m_escalates_reqs = false;
+    bool m_uses_env = false;
 
     std::set<CallStateUtilities::Field> m_recorded_fields;
     std::list<FieldData> m_field_order;
@@ -34,17 +34,17 @@ ContractRvAnalyzer::ContractRvAnalyzer(
     _func.body().accept(*this);
 }
 
-set<ContractDefinition const*> ContractRvAnalyzer::internals() const
+set<ContractDefinition const*> const& ContractRvAnalyzer::internals() const
 {
     return m_internal_refs;
 }
 
-set<ContractDefinition const*> ContractRvAnalyzer::externals() const
+set<ContractDefinition const*> const& ContractRvAnalyzer::externals() const
 {
     return m_external_refs;
 }
 
-set<ContractRvAnalyzer::Key> ContractRvAnalyzer::dependencies() const
+set<ContractRvAnalyzer::Key> const& ContractRvAnalyzer::dependencies() const
 {
     return m_procedural_calls;
 }
@@ -106,7 +106,11 @@ bool ContractRvAnalyzer::visit(FunctionCall const& _node)
 	if (KIND == FunctionCallKind::FunctionCall)
     {
         FunctionCallAnalyzer call(_node);
-        if (call.classify() == FunctionCallAnalyzer::CallGroup::Method)
+        if (call.is_in_library())
+        {
+            m_procedural_calls.insert(make_pair(nullptr, &call.decl()));
+        }
+        else if (call.classify() == FunctionCallAnalyzer::CallGroup::Method)
         {
             if (call.is_super())
             {
@@ -142,10 +146,6 @@ bool ContractRvAnalyzer::visit(FunctionCall const& _node)
                 m_procedural_calls.insert(make_pair(user, match));
             }
         }
-        else if (call.is_in_library())
-        {
-            m_procedural_calls.insert(make_pair(nullptr, &call.decl()));
-        }
         else if (call.classify() == FunctionCallAnalyzer::CallGroup::Delegate)
         {
             throw runtime_error("Delegate calls are not allowed.");
@@ -273,7 +273,7 @@ ContractExpressionAnalyzer::ContractExpressionAnalyzer(
 ): m_allocation_graph(_allocation_graph)
 {
     ContractRvLookup lookup(_model, _allocation_graph);
-    for (auto entry : lookup.registry)
+    for (auto const& entry : lookup.registry)
     {
         auto const& src = (*entry.second);
         auto const& src_deps = src.dependencies();
@@ -289,9 +289,9 @@ ContractExpressionAnalyzer::ContractExpressionAnalyzer(
         {
             if (seen.insert(key).second)
             {
-                auto record = (*lookup.registry[key]);
-                auto internal_ext = record.internals();
-                auto external_ext = record.externals();
+                auto const& record = (*lookup.registry[key]);
+                auto const& internal_ext = record.internals();
+                auto const& external_ext = record.externals();
                 internal.insert(internal_ext.begin(), internal_ext.end());
                 external.insert(external_ext.begin(), external_ext.end());
 
@@ -43,14 +43,14 @@ public:
     );
 
     // Produces a union of all types returned by reference.
-    std::set<ContractDefinition const*> internals() const;
+    std::set<ContractDefinition const*> const& internals() const;
 
     // Produces a union of all types which reference arbitrary addresses.
-    std::set<ContractDefinition const*> externals() const;
+    std::set<ContractDefinition const*> const& externals() const;
 
     // A list of external calls which can be returned by the method.
     using Key = std::pair<ContractDefinition const*, FunctionDefinition const*>;
-    std::set<Key> dependencies() const;
+    std::set<Key> const& dependencies() const;
 
 protected:
 	bool visit(IfStatement const& _node) override;
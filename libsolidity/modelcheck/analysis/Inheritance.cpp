@@ -130,7 +130,7 @@ FunctionDefinition const&
     throw runtime_error("Could not resolve function against flat contract.");
 }
 
-list<Mapping const*> FlatContract::mappings() const
+list<Mapping const*> const& FlatContract::mappings() const
 {
     return m_mappings;
 }
@@ -158,7 +158,7 @@ FlatModel::FlatModel(
 
         // Records the contract.
         m_contracts.push_back(make_shared<FlatContract>(*contract));
-        m_lookup[contract] = m_contracts.back();
+        m_lookup[*contract] = m_contracts.back();
 
         // Adds children to the list.
         for (auto child : _allocation_graph.children_of(contract))
@@ -174,20 +174,20 @@ FlatModel::FlatModel(
         for (auto parent : contract->annotation().linearizedBaseContracts)
         {
             if (!visited.insert(parent).second) continue;
-            m_lookup[parent] = make_shared<FlatContract>(*parent);
+            m_lookup[*parent] = make_shared<FlatContract>(*parent);
         }
 
         for (auto child : _allocation_graph.children_of(contract))
         {
-            ChildRecord record{m_lookup[child.type], child.dest->name()};
-            m_children[m_lookup[contract].get()].push_back(std::move(record));
+            ChildRecord record{m_lookup[*child.type], child.dest->name()};
+            m_children[*contract].push_back(std::move(record));
         }
     }
 
     // Records the deployed contracts in the model.
     for (auto contract : _model)
     {
-        m_bundle.push_back(m_lookup[contract]);
+        m_bundle.push_back(m_lookup[*contract]);
     }
 }
 
@@ -197,10 +197,10 @@ FlatModel::FlatList FlatModel::view() const { return m_contracts; }
 
 shared_ptr<FlatContract> FlatModel::get(ContractDefinition const& _src) const
 {
-    auto match = m_lookup.find(&_src);
-    if (match != m_lookup.end())
+    auto const* MATCH = m_lookup.find(_src);
+    if (MATCH)
     {
-        return match->second;
+        return *MATCH;
     }
     return nullptr;
 }
@@ -208,10 +208,10 @@ shared_ptr<FlatContract> FlatModel::get(ContractDefinition const& _src) const
 std::vector<FlatModel::ChildRecord>
     FlatModel::children_of(FlatContract const& _contract) const
 {
-    auto match = m_children.find(&_contract);
-    if (match != m_children.end())
+    auto const* MATCH = m_children.find(*_contract.raw());
+    if (MATCH)
     {
-        return match->second;
+        return *MATCH;
     }
     return {};
 }
@@ -8,6 +8,7 @@
 
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/modelcheck/analysis/Structure.h>
+#include <libsolidity/modelcheck/utils/NodeTable.h>
 
 #include <list>
 #include <map>
@@ -58,7 +59,7 @@ public:
         resolve(FunctionDefinition const& _func) const;
 
     // Returns the mappings defiend (directly) by this contract.
-    std::list<Mapping const*> mappings() const;
+    std::list<Mapping const*> const& mappings() const;
 
     // Returns true if the contract is payable.
     bool is_payable() const;
@@ -113,8 +114,9 @@ public:
 private:
     FlatList m_contracts;
     FlatList m_bundle;
-    std::map<ContractDefinition const*, std::shared_ptr<FlatContract>> m_lookup;
-    std::map<FlatContract const*, std::vector<ChildRecord>> m_children;
+    // Both tables are indexed by the contract being flattened.
+    NodeTable<std::shared_ptr<FlatContract>> m_lookup;
+    NodeTable<std::vector<ChildRecord>> m_children;
 };
 
 // -------------------------------------------------------------------------- //
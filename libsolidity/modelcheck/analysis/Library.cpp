@@ -23,7 +23,7 @@ Library::Library(
 {
 }
 
-list<FunctionDefinition const*> Library::functions() const
+list<FunctionDefinition const*> const& Library::functions() const
 {
     return m_functions;
 }
@@ -50,7 +50,7 @@ LibrarySummary::LibrarySummary(CallGraph const& _calls)
     }
 }
 
-list<shared_ptr<Library const>> LibrarySummary::view() const
+list<shared_ptr<Library const>> const& LibrarySummary::view() const
 {
     return m_libraries;
 }
@@ -36,7 +36,7 @@ public:
     );
 
     // Returns the used methods of the library.
-    std::list<FunctionDefinition const*> functions() const;
+    std::list<FunctionDefinition const*> const& functions() const;
 
 private:
     std::list<FunctionDefinition const*> m_functions;
@@ -52,7 +52,7 @@ public:
     LibrarySummary(CallGraph const& _calls);
 
     //
-    std::list<std::shared_ptr<Library const>> view() const;
+    std::list<std::shared_ptr<Library const>> const& view() const;
 
 private:
     std::list<std::shared_ptr<Library const>> m_libraries;
@@ -27,7 +27,7 @@ void MappingExtractor::record(VariableDeclaration const* _var)
     _var->accept(*this);
 }
 
-list<Mapping const*> MappingExtractor::get() const { return m_mappings; }
+list<Mapping const*> const& MappingExtractor::get() const { return m_mappings; }
 
 bool MappingExtractor::visit(Mapping const& _node)
 {
@@ -37,7 +37,7 @@ bool MappingExtractor::visit(Mapping const& _node)
 
 // -------------------------------------------------------------------------- //
 
-MapDeflate::FlatMap MapDeflate::query(Mapping const& _map)
+MapDeflate::FlatMap const& MapDeflate::query(Mapping const& _map)
 {
     auto & flatmap = m_flatset[&_map];
 
@@ -57,7 +57,8 @@ MapDeflate::FlatMap MapDeflate::query(Mapping const& _map)
     return flatmap;
 }
 
-MapDeflate::FlatMap MapDeflate::resolve(Mapping const& _mapping) const
+MapDeflate::FlatMap const&
+    MapDeflate::resolve(Mapping const& _mapping) const
 {
     auto const& record = m_flatset.find(&_mapping);
     if (record == m_flatset.end())
@@ -67,7 +68,8 @@ MapDeflate::FlatMap MapDeflate::resolve(Mapping const& _mapping) const
     return record->second;
 }
 
-MapDeflate::FlatMap MapDeflate::resolve(VariableDeclaration const& _decl) const
+MapDeflate::FlatMap const&
+    MapDeflate::resolve(VariableDeclaration const& _decl) const
 {
     auto const* mapping = dynamic_cast<Mapping*>(_decl.typeName());
     if (!mapping)
@@ -40,7 +40,7 @@ public:
     void record(VariableDeclaration const* _var);
 
     // Returns the extracted mappings.
-    std::list<Mapping const*> get() const;
+    std::list<Mapping const*> const& get() const;
 
 protected:
 	bool visit(Mapping const& _node) override;
@@ -72,12 +72,12 @@ public:
     // it in the map lookup. For a Mapping typename of the form
     // mapping(A => mapping(B => mapping(C => ...))). a FlatMap with key
     // tuple(A, B, C, ...) will be produced.
-    FlatMap query(Mapping const& _mapping);
+    FlatMap const& query(Mapping const& _mapping);
 
     // Queries the FlatMap for the given declaration, and throws an exception on
     // failed lookup.
-    FlatMap resolve(Mapping const& _decl) const;
-    FlatMap resolve(VariableDeclaration const& _decl) const;
+    FlatMap const& resolve(Mapping const& _decl) const;
+    FlatMap const& resolve(VariableDeclaration const& _decl) const;
 
 private:
     std::map<Mapping const*, FlatMap> m_flatset;
@@ -280,6 +280,16 @@ void PrimitiveTypeGenerator::record_type(Type const* _type)
             throw runtime_error("Type category conflicts type class: Fixed.");
         }
         break;
+    case Type::Category::FixedBytes:
+        if (auto bytes_type = dynamic_cast<FixedBytesType const*>(_type))
+        {
+            record_uint(bytes_type->numBytes() * 8);
+        }
+        else
+        {
+            throw runtime_error("Type category conflicts type class: Bytes.");
+        }
+        break;
     default:
         break;
     }
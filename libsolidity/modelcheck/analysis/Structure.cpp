@@ -20,12 +20,12 @@ Structure::Structure(StructDefinition const& _struct)
  , m_raw(&_struct)
 {}
 
-list<ASTPointer<VariableDeclaration>> Structure::fields() const
+list<ASTPointer<VariableDeclaration>> const& Structure::fields() const
 {
     return m_members;
 }
 
-list<Mapping const*> Structure::mappings() const { return m_mappings; }
+list<Mapping const*> const& Structure::mappings() const { return m_mappings; }
 
 StructDefinition const* Structure::raw() const { return m_raw; }
 
@@ -44,7 +44,8 @@ StructureContainer::StructureContainer(ContractDefinition const& _contract)
     }
 }
 
-list<shared_ptr<Structure const>> StructureContainer::structures() const
+list<shared_ptr<Structure const>> const&
+    StructureContainer::structures() const
 {
     return m_structures;
 }
@@ -33,10 +33,10 @@ public:
     explicit Structure(StructDefinition const& _struct);
 
     // Returns the list of mappings required by the structure.
-    std::list<Mapping const*> mappings() const;
+    std::list<Mapping const*> const& mappings() const;
 
     // Returns the fields of the structure.
-    std::list<ASTPointer<VariableDeclaration>> fields() const;
+    std::list<ASTPointer<VariableDeclaration>> const& fields() const;
 
     // TODO(scottwe): temporary solution to simplify transition.
     StructDefinition const* raw() const;
@@ -60,7 +60,7 @@ public:
     virtual ~StructureContainer() = default;
 
     // Returns the structures defined by this contract.
-    std::list<std::shared_ptr<Structure const>> structures() const;
+    std::list<std::shared_ptr<Structure const>> const& structures() const;
 
     // TODO(scottwe): temporary solution to simplify transition.
     ContractDefinition const* raw() const;
@@ -1,5 +1,6 @@
 #include <libsolidity/modelcheck/analysis/TypeNames.h>
 
+#include <libsolidity/modelcheck/analysis/Primitives.h>
 #include <libsolidity/modelcheck/codegen/Details.h>
 #include <libsolidity/modelcheck/codegen/Literals.h>
 #include <libsolidity/modelcheck/utils/Function.h>
@@ -49,7 +50,7 @@ void TypeAnalyzer::record(SourceUnit const& _unit)
 
         for (auto e : contract->definedEnums())
         {
-            m_type_lookup.insert({e, get_simple_ctype(*e->type())});
+            record_type(*e, get_simple_ctype(*e->type()));
         }
 
         for (auto structure : contract->definedStructs())
@@ -57,12 +58,12 @@ void TypeAnalyzer::record(SourceUnit const& _unit)
             ostringstream struct_oss;
             struct_oss << cname << "_Struct_" << escape_decl_name(*structure);
 
-            m_name_lookup.insert({structure, struct_oss.str()});
-            m_type_lookup.insert({structure, "struct " + struct_oss.str()});
+            record_name(*structure, struct_oss.str());
+            record_type(*structure, "struct " + struct_oss.str());
         }
 
-        m_name_lookup.insert({contract, cname});
-        m_type_lookup.insert({contract, "struct " + cname});
+        record_name(*contract, cname);
+        record_type(*contract, "struct " + cname);
     }
 
     // Pass 2: assign types to all member fields and methods, such that their
@@ -100,8 +101,8 @@ void TypeAnalyzer::record(SourceUnit const& _unit)
                 // TODO: is this still used?
                 auto const FUNC_RETURN_TYPE = get_type(*returnParams);
                 auto const FUNC_NAME = FunctionSpecialization(*fun).name(0);
-                m_name_lookup.insert({fun, FUNC_NAME});
-                m_type_lookup.insert({fun, FUNC_RETURN_TYPE});
+                record_name(*fun, FUNC_NAME);
+                record_type(*fun, FUNC_RETURN_TYPE);
             }
 
             for (auto modifier : con->functionModifiers())
@@ -139,25 +140,26 @@ bool TypeAnalyzer::is_pointer(Identifier const& _id) const
     return RES != m_in_storage.end() && RES->second;
 }
 
-string TypeAnalyzer::get_type(ASTNode const& _node) const
+string const& TypeAnalyzer::get_type(ASTNode const& _node) const
 {
-    if (m_type_lookup.find(&_node) == m_type_lookup.end())
+    auto const* RES = m_type_lookup.find(_node);
+    if (!RES)
     {
         string name = get_error_type(&_node);
         throw runtime_error("get_type called on unknown ASTNode: " + name);
     }
-    return m_type_lookup.find(&_node)->second;
+    return m_names.at(*RES);
 }
 
-string TypeAnalyzer::get_name(ASTNode const& _node) const
+string const& TypeAnalyzer::get_name(ASTNode const& _node) const
 {
-    auto const& RES = m_name_lookup.find(&_node);
-    if (RES == m_name_lookup.end())
+    auto const* RES = m_name_lookup.find(_node);
+    if (!RES)
     {
         string name = get_error_type(&_node);
         throw runtime_error("get_name called on unknown ASTNode: " + name);
     }
-    return RES->second;
+    return m_names.at(*RES);
 }
 
 // -------------------------------------------------------------------------- //
@@ -224,13 +226,67 @@ CExprPtr TypeAnalyzer::get_init_val(TypeName const& _typename) const
 
 CExprPtr TypeAnalyzer::get_init_val(Declaration const& _decl) const
 {
-    if (has_simple_type(_decl)) return init_val_by_simple_type(*_decl.type());
+    if (has_simple_type(_decl)) return wrap(_decl, Literals::ZERO);
     return InitFunction(*this, _decl).defaulted();
 }
 
 // -------------------------------------------------------------------------- //
 
-MapDeflate TypeAnalyzer::map_db() const { return m_map_db; }
+MapDeflate const& TypeAnalyzer::map_db() const { return m_map_db; }
+
+// -------------------------------------------------------------------------- //
+
+void TypeAnalyzer::narrow(VariableDeclaration const& _decl, uint16_t _bits)
+{
+    auto const* TYPE = dynamic_cast<IntegerType const*>(&unwrap(*_decl.type()));
+    if (!TYPE || TYPE->isSigned())
+    {
+        throw runtime_error("Only unsigned integers may be narrowed.");
+    }
+    else if (_bits == 0 || _bits % 8 != 0 || _bits > TYPE->numBits())
+    {
+        throw runtime_error("Narrowing requires a smaller multiple of 8 bits.");
+    }
+
+    m_narrowed[&_decl] = _bits;
+    auto const TYPE_ID = m_names.intern("sol_uint" + to_string(_bits) + "_t");
+    m_type_lookup[_decl] = TYPE_ID;
+}
+
+bool TypeAnalyzer::is_narrowed(VariableDeclaration const& _decl) const
+{
+    return (m_narrowed.find(&_decl) != m_narrowed.end());
+}
+
+uint16_t TypeAnalyzer::narrowed_width(VariableDeclaration const& _decl) const
+{
+    auto const RES = m_narrowed.find(&_decl);
+    if (RES == m_narrowed.end())
+    {
+        throw runtime_error("Width requested for variable which is not narrowed.");
+    }
+    return RES->second;
+}
+
+CExprPtr TypeAnalyzer::wrap(Declaration const& _decl, CExprPtr _expr) const
+{
+    auto const* VAR = dynamic_cast<VariableDeclaration const*>(&_decl);
+    if (VAR && is_narrowed(*VAR))
+    {
+        return make_shared<CFuncCall>(
+            InitFunction(get_type(*VAR)).call_name(), CArgList{ move(_expr) }
+        );
+    }
+    return InitFunction::wrap(*_decl.type(), move(_expr));
+}
+
+void TypeAnalyzer::register_primitives(PrimitiveTypeGenerator& _gen) const
+{
+    for (auto const& entry : m_narrowed)
+    {
+        _gen.record_uint(entry.second);
+    }
+}
 
 // -------------------------------------------------------------------------- //
 
@@ -250,10 +306,10 @@ bool TypeAnalyzer::visit(VariableDeclaration const& _node)
         ScopedSwap<VariableDeclaration const*> decl_swap(m_curr_decl, &_node);
         auto const& VAR_TYPENAME = *_node.typeName();
         VAR_TYPENAME.accept(*this);
-        m_type_lookup.insert({&_node, get_type(VAR_TYPENAME)});
+        record_type(_node, get_type(VAR_TYPENAME));
         if (!has_simple_type(VAR_TYPENAME))
         {
-            m_name_lookup.insert({&_node, get_name(VAR_TYPENAME)});
+            record_name(_node, get_name(VAR_TYPENAME));
         }
     }
 
@@ -262,17 +318,17 @@ bool TypeAnalyzer::visit(VariableDeclaration const& _node)
 
 bool TypeAnalyzer::visit(ElementaryTypeName const& _node)
 {
-    m_type_lookup.insert({&_node, get_simple_ctype(*_node.annotation().type)});
+    record_type(_node, get_simple_ctype(*_node.annotation().type));
     return false;
 }
 
 bool TypeAnalyzer::visit(UserDefinedTypeName const& _node)
 {
     auto const& REF = *_node.annotation().referencedDeclaration;
-    m_type_lookup.insert({&_node, get_type(REF)});
+    record_type(_node, get_type(REF));
     if (!has_simple_type(REF))
     {
-        m_name_lookup.insert({&_node, get_name(REF)});
+        record_name(_node, get_name(REF));
     }
     return false;
 }
@@ -286,8 +342,8 @@ bool TypeAnalyzer::visit(FunctionTypeName const& _node)
 bool TypeAnalyzer::visit(Mapping const& _node)
 {
     auto const& record = m_map_db.query(_node);
-    m_name_lookup.insert({&_node, record.name});
-    m_type_lookup.insert({&_node, "struct " + record.name});
+    record_name(_node, record.name);
+    record_type(_node, "struct " + record.name);
 
     for (auto const* key : record.key_types) key->accept(*this);
     record.value_type->accept(*this);
@@ -306,8 +362,8 @@ bool TypeAnalyzer::visit(IndexAccess const& _node)
     FlatIndex idx(_node);
     auto const& record = m_map_db.resolve(idx.decl());
 
-    m_type_lookup.insert({&_node, get_type(*record.value_type)});
-    m_name_lookup.insert({&_node, record.name});
+    record_type(_node, get_type(*record.value_type));
+    record_name(_node, record.name);
 
     for (auto const* idx_expr : idx.indices()) idx_expr->accept(*this);
     idx.base().accept(*this);
@@ -333,14 +389,14 @@ void TypeAnalyzer::endVisit(ParameterList const& _node)
             ctype = get_type(PARAM);
             if (!has_simple_type(PARAM))
             {
-                m_name_lookup.insert({&_node, get_name(PARAM)});
+                record_name(_node, get_name(PARAM));
             }
         }
         else
         {
             ctype = "void";
         }
-        m_type_lookup.insert({&_node, ctype});
+        record_type(_node, ctype);
     }
 }
 
@@ -348,10 +404,10 @@ void TypeAnalyzer::endVisit(MemberAccess const& _node)
 {
     if (auto decl = member_access_to_decl(_node))
     {
-        m_type_lookup.insert({&_node, get_type(*decl)});
+        record_type(_node, get_type(*decl));
         if (!has_simple_type(*decl))
         {
-            m_name_lookup.insert({&_node, get_name(*decl)});
+            record_name(_node, get_name(*decl));
         }
     }
 }
@@ -364,13 +420,13 @@ void TypeAnalyzer::endVisit(Identifier const& _node)
     auto const MAGIC_RES = m_global_context_types.find(NODE_NAME);
     if (MAGIC_RES != m_global_context_types.end())
     {
-        m_type_lookup.insert({&_node, MAGIC_RES->second});
+        record_type(_node, MAGIC_RES->second);
         m_in_storage.insert({&_node, false});
 
         auto const MAGIC_SIMP = m_global_context_simple_values.find(NODE_NAME);
         if (MAGIC_SIMP != m_global_context_simple_values.end())
         {
-            m_name_lookup.insert({&_node, NODE_NAME});
+            record_name(_node, NODE_NAME);
         }
     }
     else
@@ -392,17 +448,29 @@ void TypeAnalyzer::endVisit(Identifier const& _node)
             }
         }
 
-        m_type_lookup.insert({&_node, get_type(*ref)});
+        record_type(_node, get_type(*ref));
         m_in_storage.insert({&_node, loc == VariableDeclaration::Storage});
         if (!has_simple_type(*ref))
         {
-            m_name_lookup.insert({&_node, get_name(*ref)});
+            record_name(_node, get_name(*ref));
         }
     }
 }
 
 // -------------------------------------------------------------------------- //
 
+void TypeAnalyzer::record_type(ASTNode const& _node, string const& _type)
+{
+    m_type_lookup.insert(_node, m_names.intern(_type));
+}
+
+void TypeAnalyzer::record_name(ASTNode const& _node, string const& _name)
+{
+    m_name_lookup.insert(_node, m_names.intern(_name));
+}
+
+// -------------------------------------------------------------------------- //
+
 }
 }
 }
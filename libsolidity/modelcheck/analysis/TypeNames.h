@@ -12,6 +12,7 @@
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/modelcheck/analysis/Mapping.h>
 #include <libsolidity/modelcheck/codegen/Core.h>
+#include <libsolidity/modelcheck/utils/NodeTable.h>
 
 #include <map>
 #include <set>
@@ -24,6 +25,8 @@ namespace solidity
 namespace modelcheck
 {
 
+class PrimitiveTypeGenerator;
+
 // -------------------------------------------------------------------------- //
 
 /*
@@ -40,11 +43,11 @@ public:
 
     // Returns the CType used to model _node, given that has_record has returned
     // true for _node.
-    std::string get_type(ASTNode const& _node) const;
+    std::string const& get_type(ASTNode const& _node) const;
 
     // Returns the representative name for _node, given that has_record has
     // returned true for _node, whereas is_simple_type has filed.
-    std::string get_name(ASTNode const& _node) const;
+    std::string const& get_name(ASTNode const& _node) const;
 
     // Returns true is _id is a pointer. If this cannot be resolved, false is
     // returned.
@@ -63,7 +66,24 @@ public:
 	CExprPtr get_init_val(Declaration const& _decl) const;
 
     // Provides a view of the map database.
-    MapDeflate map_db() const;
+    MapDeflate const& map_db() const;
+
+    // Overrides the CType of unsigned variable _decl, so that it is modeled with
+    // _bits bits. The Solidity type is unchanged, so reads should be widened.
+    void narrow(VariableDeclaration const& _decl, uint16_t _bits);
+
+    // Returns true if _decl has been narrowed.
+    bool is_narrowed(VariableDeclaration const& _decl) const;
+
+    // Returns the width of _decl after narrowing. Requires is_narrowed(_decl).
+    uint16_t narrowed_width(VariableDeclaration const& _decl) const;
+
+    // Applies the initializer for the CType of _decl to _expr. This is
+    // equivalent to InitFunction::wrap, except that narrowing is respected.
+    CExprPtr wrap(Declaration const& _decl, CExprPtr _expr) const;
+
+    // Registers all types introduced through narrowing with _gen.
+    void register_primitives(PrimitiveTypeGenerator& _gen) const;
 
 protected:
     bool visit(VariableDeclaration const& _node) override;
@@ -88,13 +108,19 @@ private:
 
     MapDeflate m_map_db;
 
-    std::map<ASTNode const*, std::string> m_name_lookup;
-    std::map<ASTNode const*, std::string> m_type_lookup;
+    NameTable m_names;
+    NodeTable<NameTable::Id> m_name_lookup;
+    NodeTable<NameTable::Id> m_type_lookup;
     std::map<Identifier const*, bool> m_in_storage;
+    std::map<VariableDeclaration const*, uint16_t> m_narrowed;
 
     ContractDefinition const* m_curr_contract = nullptr;
     VariableDeclaration const* m_curr_decl = nullptr;
     bool m_is_retval = false;
+
+    // Sets the C type (resp. name) of _node, unless it has already been set.
+    void record_type(ASTNode const& _node, std::string const& _type);
+    void record_name(ASTNode const& _node, std::string const& _name);
 };
 
 // -------------------------------------------------------------------------- //
@@ -37,12 +37,13 @@ FunctionSpecialization const* VariableScopeResolver::spec() const
 
 void VariableScopeResolver::enter()
 {
-    m_scopes.emplace_back();
+    m_scope_starts.push_back(m_names.size());
 }
 
 void VariableScopeResolver::exit()
 {
-    m_scopes.pop_back();
+    m_names.resize(m_scope_starts.back());
+    m_scope_starts.pop_back();
 }
 
 // -------------------------------------------------------------------------- //
@@ -51,7 +52,7 @@ void VariableScopeResolver::record_declaration(VariableDeclaration const& _decl)
 {
     if (!_decl.name().empty())
     {
-        m_scopes.back().insert(_decl.name());
+        m_names.push_back(&_decl.name());
     }
 }
 
@@ -111,9 +112,9 @@ string VariableScopeResolver::resolve_sym(string const& _sym) const
 
     // This is not a special case, so scope resolution is applied.
     bool shadow = (M_CODE_TYPE == CodeType::SHADOWBLOCK);
-    for (auto scope = m_scopes.crbegin(); scope != m_scopes.crend(); scope++)
+    for (auto name = m_names.crbegin(); name != m_names.crend(); name++)
     {
-        if (scope->find(_sym) != scope->cend())
+        if (**name == _sym)
         {
             return rewrite(_sym, shadow, VarContext::FUNCTION);
         }
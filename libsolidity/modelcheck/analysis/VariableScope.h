@@ -9,9 +9,8 @@
 
 #include <libsolidity/ast/AST.h>
 
-#include <list>
-#include <set>
 #include <string>
+#include <vector>
 
 namespace dev
 {
@@ -68,7 +67,10 @@ private:
 
     FunctionSpecialization const* m_spec;
 
-    std::list<std::set<std::string>> m_scopes;
+    // The names declared in each scope, stored as a single stack. The names
+    // are owned by the AST. Scope i begins at m_scope_starts[i].
+    std::vector<std::string const*> m_names;
+    std::vector<size_t> m_scope_starts;
 
     // Consumes the string representation of an identifier, _sym, and maps it to
     // a SmartACE identifier.
@@ -24,6 +24,33 @@ bool CExpr::is_pointer() const
     return false;
 }
 
+CExprPtr CExpr::simplify() const
+{
+    return nullptr;
+}
+
+bool CExpr::is_constant(long long int &) const
+{
+    return false;
+}
+
+// -------------------------------------------------------------------------- //
+
+CLineMarker::CLineMarker(string _file, size_t _line)
+: M_FILE(move(_file)), M_LINE(_line) {}
+
+void CLineMarker::print(ostream & _out) const
+{
+    // Directives must start on a new line, and code must follow on the next.
+    _out << endl << "#line " << M_LINE << " \"";
+    for (char c : M_FILE)
+    {
+        if (c == '\\' || c == '"') _out << '\\';
+        _out << c;
+    }
+    _out << "\"" << endl;
+}
+
 // -------------------------------------------------------------------------- //
 
 void CStmt::nest()
@@ -31,12 +58,46 @@ void CStmt::nest()
     m_is_nested = true;
 }
 
+void CStmt::mark(shared_ptr<CLineMarker const> _marker)
+{
+    m_marker = move(_marker);
+}
+
 void CStmt::print(ostream & _out) const
 {
+    if (m_marker) _out << *m_marker;
     print_impl(_out);
     if (!m_is_nested) _out << ";";
 }
 
+CStmtPtr CStmt::simplify() const
+{
+    auto stmt = simplify_impl();
+    if (stmt && !stmt->m_marker) stmt->m_marker = m_marker;
+    return stmt;
+}
+
+CStmtPtr CStmt::simplify_impl() const
+{
+    return nullptr;
+}
+
+// -------------------------------------------------------------------------- //
+
+CExprPtr simplify(CExprPtr const& _expr)
+{
+    if (!_expr) return _expr;
+    auto expr = _expr->simplify();
+    return (expr ? expr : _expr);
+}
+
+CStmtPtr simplify(CStmtPtr const& _stmt)
+{
+    if (!_stmt) return _stmt;
+    auto stmt = _stmt->simplify();
+    return (stmt ? stmt : _stmt);
+}
+
 // -------------------------------------------------------------------------- //
 
 }
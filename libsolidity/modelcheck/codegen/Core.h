@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <ostream>
+#include <string>
 #include <vector>
 
 namespace dev
@@ -45,6 +46,33 @@ public:
 
     // Overriden to determine if an element is a pointer. Defaults to false.
     virtual bool is_pointer() const;
+
+    // Returns an equivalent expression in which all constant subexpressions
+    // are folded. If nothing can be folded, then nullptr is returned.
+    virtual std::shared_ptr<CExpr> simplify() const;
+
+    // Returns true if this expression is an integer constant, stored in _val.
+    virtual bool is_constant(long long int & _val) const;
+};
+
+// -------------------------------------------------------------------------- //
+
+/**
+ * A #line directive, which attributes all subsequent C code to a line of the
+ * original source file. This allows debuggers, profilers and coverage tools to
+ * report against the Solidity source, rather than the generated model.
+ */
+class CLineMarker : public CElement
+{
+public:
+    // Marks the C code which follows as line _line of _file.
+    CLineMarker(std::string _file, size_t _line);
+
+    void print(std::ostream & _out) const override;
+
+private:
+    std::string const M_FILE;
+    size_t const M_LINE;
 };
 
 // -------------------------------------------------------------------------- //
@@ -62,11 +90,23 @@ public:
     // Once called, the stmt will print itself as if it were a nested sub-stmt.
     void nest();
 
+    // Once called, the stmt will print _marker before itself.
+    void mark(std::shared_ptr<CLineMarker const> _marker);
+
+    // Returns an equivalent statement in which constants are folded and
+    // unreachable code is pruned. A statement without effect simplifies to an
+    // empty block. If nothing can be simplified, then nullptr is returned.
+    std::shared_ptr<CStmt> simplify() const;
+
 private:
     bool m_is_nested = false;
+    std::shared_ptr<CLineMarker const> m_marker;
 
     // Prints the statement, modulo any ending tokens (ie semi-colons).
     virtual void print_impl(std::ostream & _out) const = 0;
+
+    // Overriden to implement simplify. Defaults to nullptr.
+    virtual std::shared_ptr<CStmt> simplify_impl() const;
 };
 
 // -------------------------------------------------------------------------- //
@@ -80,6 +120,16 @@ using CParams = std::vector<std::shared_ptr<CVarDecl>>;
 
 // -------------------------------------------------------------------------- //
 
+// Returns the simplification of _expr, or _expr if it cannot be simplified.
+// Null expressions are forwarded as is.
+CExprPtr simplify(CExprPtr const& _expr);
+
+// Returns the simplification of _stmt, or _stmt if it cannot be simplified.
+// Null statements are forwarded as is.
+CStmtPtr simplify(CStmtPtr const& _stmt);
+
+// -------------------------------------------------------------------------- //
+
 }
 }
 }
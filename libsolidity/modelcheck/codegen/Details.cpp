@@ -4,6 +4,10 @@
 #include <libsolidity/modelcheck/utils/Function.h>
 #include <libsolidity/modelcheck/utils/Types.h>
 
+#include <libdevcore/Common.h>
+
+#include <limits>
+
 using namespace std;
 
 namespace dev
@@ -46,6 +50,8 @@ void CIdentifier::print(ostream & _out) const { _out << M_NAME; }
 
 bool CIdentifier::is_pointer() const { return M_IS_PTR; }
 
+string const& CIdentifier::name() const { return M_NAME; }
+
 CExprPtr CIdentifier::expr() const
 {
     return make_shared<CIdentifier>(M_NAME, M_IS_PTR);
@@ -57,6 +63,12 @@ CIntLiteral::CIntLiteral(long long int _val): M_VAL(_val) {}
 
 void CIntLiteral::print(ostream & _out) const { _out << M_VAL; }
 
+bool CIntLiteral::is_constant(long long int & _val) const
+{
+    _val = M_VAL;
+    return true;
+}
+
 // -------------------------------------------------------------------------- //
 
 string CStringLiteral::escape_cstring(string _val)
@@ -91,6 +103,29 @@ void CUnaryOp::print(ostream & _out) const
     if (!M_PRE) _out << M_OP;
 }
 
+CExprPtr CUnaryOp::simplify() const
+{
+    if (!M_PRE) return nullptr;
+    if (M_OP != "!" && M_OP != "-" && M_OP != "~" && M_OP != "+") return nullptr;
+
+    auto expr = modelcheck::simplify(M_EXPR);
+
+    long long int val;
+    if (expr->is_constant(val))
+    {
+        if (M_OP == "!") return make_shared<CIntLiteral>(!val);
+        if (M_OP == "~") return make_shared<CIntLiteral>(~val);
+        if (M_OP == "+") return make_shared<CIntLiteral>(val);
+        if (val != numeric_limits<long long int>::min())
+        {
+            return make_shared<CIntLiteral>(-val);
+        }
+    }
+
+    if (expr == M_EXPR) return nullptr;
+    return make_shared<CUnaryOp>(M_OP, move(expr), M_PRE);
+}
+
 CStmtPtr CUnaryOp::stmt()
 {
     return make_shared<CExprStmt>(make_shared<CUnaryOp>(M_OP, M_EXPR, M_PRE));
@@ -117,6 +152,75 @@ void CBinaryOp::print(ostream & _out) const
     _out << "(" << *M_LHS << ")" << M_OP << "(" << *M_RHS << ")";
 }
 
+CExprPtr CBinaryOp::simplify() const
+{
+    auto lhs = modelcheck::simplify(M_LHS);
+    auto rhs = modelcheck::simplify(M_RHS);
+
+    long long int lval, rval, res;
+    bool const LHS_CONST = lhs->is_constant(lval);
+    bool const RHS_CONST = rhs->is_constant(rval);
+    if (LHS_CONST && RHS_CONST && fold(lval, M_OP, rval, res))
+    {
+        return make_shared<CIntLiteral>(res);
+    }
+    else if (LHS_CONST && M_OP == "&&" && lval == 0)
+    {
+        return make_shared<CIntLiteral>(0);
+    }
+    else if (LHS_CONST && M_OP == "||" && lval != 0)
+    {
+        return make_shared<CIntLiteral>(1);
+    }
+
+    if (lhs == M_LHS && rhs == M_RHS) return nullptr;
+    return make_shared<CBinaryOp>(move(lhs), M_OP, move(rhs));
+}
+
+bool CBinaryOp::fold(
+    long long int _lhs, string const& _op, long long int _rhs, long long int & _res
+)
+{
+    dev::bigint const LHS(_lhs);
+    dev::bigint const RHS(_rhs);
+
+    dev::bigint res;
+    if (_op == "+") res = LHS + RHS;
+    else if (_op == "-") res = LHS - RHS;
+    else if (_op == "*") res = LHS * RHS;
+    else if (_op == "/" && _rhs != 0) res = LHS / RHS;
+    else if (_op == "%" && _rhs != 0) res = LHS % RHS;
+    else if (_op == "==") res = (_lhs == _rhs);
+    else if (_op == "!=") res = (_lhs != _rhs);
+    else if (_op == "<") res = (_lhs < _rhs);
+    else if (_op == ">") res = (_lhs > _rhs);
+    else if (_op == "<=") res = (_lhs <= _rhs);
+    else if (_op == ">=") res = (_lhs >= _rhs);
+    else if (_op == "&&") res = (_lhs && _rhs);
+    else if (_op == "||") res = (_lhs || _rhs);
+    else if (_op == "&") res = (_lhs & _rhs);
+    else if (_op == "|") res = (_lhs | _rhs);
+    else if (_op == "^") res = (_lhs ^ _rhs);
+    else if (_op == "<<" && _lhs >= 0 && _rhs >= 0 && _rhs < 63)
+    {
+        res = LHS << static_cast<unsigned>(_rhs);
+    }
+    else if (_op == ">>" && _lhs >= 0 && _rhs >= 0 && _rhs < 63)
+    {
+        res = LHS >> static_cast<unsigned>(_rhs);
+    }
+    else
+    {
+        return false;
+    }
+
+    // The minimum value is excluded, as it cannot be written as a C literal.
+    if (res <= numeric_limits<long long int>::min()) return false;
+    if (res > numeric_limits<long long int>::max()) return false;
+    _res = static_cast<long long int>(res);
+    return true;
+}
+
 CAssign::CAssign(CExprPtr _lhs, CExprPtr _rhs): CBinaryOp(_lhs, "=", _rhs) {}
 
 // -------------------------------------------------------------------------- //
@@ -138,6 +242,25 @@ void CCond::print(ostream & _out) const
 
 bool CCond::is_pointer() const { return M_TRUE_CASE->is_pointer(); }
 
+CExprPtr CCond::simplify() const
+{
+    auto cond = modelcheck::simplify(M_COND);
+
+    long long int val;
+    if (cond->is_constant(val))
+    {
+        return modelcheck::simplify(val ? M_TRUE_CASE : M_FALSE_CASE);
+    }
+
+    auto true_case = modelcheck::simplify(M_TRUE_CASE);
+    auto false_case = modelcheck::simplify(M_FALSE_CASE);
+    if (cond == M_COND && true_case == M_TRUE_CASE && false_case == M_FALSE_CASE)
+    {
+        return nullptr;
+    }
+    return make_shared<CCond>(move(cond), move(true_case), move(false_case));
+}
+
 CStmtPtr CCond::stmt()
 {
     auto cond = make_shared<CCond>(M_COND, M_TRUE_CASE, M_FALSE_CASE);
@@ -155,6 +278,13 @@ void CMemberAccess::print(ostream & _out) const
     _out << "(" << *M_EXPR << ")" << (is_ptr ? "->" : ".") << M_MEMBER;
 }
 
+CExprPtr CMemberAccess::simplify() const
+{
+    auto expr = modelcheck::simplify(M_EXPR);
+    if (expr == M_EXPR) return nullptr;
+    return make_shared<CMemberAccess>(move(expr), M_MEMBER);
+}
+
 CExprPtr CMemberAccess::expr() const
 {
     return make_shared<CMemberAccess>(M_EXPR, M_MEMBER);
@@ -172,6 +302,13 @@ void CCast::print(ostream & _out) const
 
 bool CCast::is_pointer() const { return M_EXPR->is_pointer(); }
 
+CExprPtr CCast::simplify() const
+{
+    auto expr = modelcheck::simplify(M_EXPR);
+    if (expr == M_EXPR) return nullptr;
+    return make_shared<CCast>(move(expr), M_TYPE);
+}
+
 // -------------------------------------------------------------------------- //
 
 CFuncCall::CFuncCall(string _name, CArgList _args, bool _rv_is_ref)
@@ -197,6 +334,20 @@ bool CFuncCall::is_pointer() const
     return M_RV_IS_REF;
 }
 
+CExprPtr CFuncCall::simplify() const
+{
+    bool changed = false;
+    CArgList args;
+    for (auto const& arg : M_ARGS)
+    {
+        args.push_back(modelcheck::simplify(arg));
+        changed = changed || (args.back() != arg);
+    }
+
+    if (!changed) return nullptr;
+    return make_shared<CFuncCall>(M_NAME, move(args), M_RV_IS_REF);
+}
+
 CStmtPtr CFuncCall::stmt()
 {
     return make_shared<CExprStmt>(make_shared<CFuncCall>(M_NAME, M_ARGS));
@@ -245,6 +396,8 @@ CStmtPtr CFuncCallBuilder::merge_and_pop_stmt()
 
 CBlock::CBlock(CBlockList _stmts) : M_STMTS(move(_stmts)) { nest(); }
 
+CBlockList const& CBlock::stmts() const { return M_STMTS; }
+
 void CBlock::print_impl(ostream & _out) const
 {
     _out << "{";
@@ -252,12 +405,98 @@ void CBlock::print_impl(ostream & _out) const
     _out << "}";
 }
 
+CStmtPtr CBlock::simplify_impl() const
+{
+    bool changed = false;
+    CBlockList stmts;
+    for (auto const& original : M_STMTS)
+    {
+        auto stmt = modelcheck::simplify(original);
+        changed = changed || (stmt != original);
+
+        // Nested blocks without declarations are spliced into this block.
+        auto block = dynamic_pointer_cast<CBlock>(stmt);
+        if (block && !block->declares())
+        {
+            changed = true;
+            for (auto const& nested : block->stmts())
+            {
+                stmts.push_back(nested);
+                if (is_jump(nested)) break;
+            }
+            if (!stmts.empty() && is_jump(stmts.back())) break;
+            continue;
+        }
+
+        // A temporary which is returned immediately is forwarded.
+        auto ret = dynamic_pointer_cast<CReturn>(stmt);
+        if (ret && ret->retval() && !stmts.empty())
+        {
+            auto decl = dynamic_pointer_cast<CVarDecl>(stmts.back());
+            auto id = dynamic_pointer_cast<CIdentifier>(ret->retval());
+            if (decl && id && decl->init() && decl->id()->name() == id->name())
+            {
+                stmts.back() = make_shared<CReturn>(decl->init());
+                changed = true;
+                break;
+            }
+        }
+
+        // All statements after a jump are unreachable.
+        stmts.push_back(stmt);
+        if (is_jump(stmt))
+        {
+            changed = changed || (&original != &M_STMTS.back());
+            break;
+        }
+    }
+
+    if (!changed) return nullptr;
+    return make_shared<CBlock>(move(stmts));
+}
+
+bool CBlock::declares() const
+{
+    for (auto const& stmt : M_STMTS)
+    {
+        if (dynamic_pointer_cast<CVarDecl>(stmt)) return true;
+    }
+    return false;
+}
+
+bool CBlock::is_jump(CStmtPtr const& _stmt)
+{
+    if (dynamic_pointer_cast<CReturn>(_stmt)) return true;
+    if (dynamic_pointer_cast<CBreak>(_stmt)) return true;
+    if (dynamic_pointer_cast<CContinue>(_stmt)) return true;
+    if (auto block = dynamic_pointer_cast<CBlock>(_stmt))
+    {
+        return !block->stmts().empty() && is_jump(block->stmts().back());
+    }
+    return false;
+}
+
 // -------------------------------------------------------------------------- //
 
 CExprStmt::CExprStmt(CExprPtr _expr): M_EXPR(move(_expr)) {}
 
 void CExprStmt::print_impl(ostream & _out) const { _out << *M_EXPR; }
 
+CStmtPtr CExprStmt::simplify_impl() const
+{
+    auto expr = modelcheck::simplify(M_EXPR);
+
+    // Constants and identifiers have no effect.
+    long long int val;
+    if (expr->is_constant(val) || dynamic_pointer_cast<CIdentifier>(expr))
+    {
+        return make_shared<CBlock>(CBlockList{});
+    }
+
+    if (expr == M_EXPR) return nullptr;
+    return make_shared<CExprStmt>(move(expr));
+}
+
 // -------------------------------------------------------------------------- //
 
 CVarDecl::CVarDecl(string _type, string _name, bool _ptr, CExprPtr _init)
@@ -277,11 +516,23 @@ shared_ptr<CIdentifier> CVarDecl::id() const
     return make_shared<CIdentifier>(M_NAME, M_IS_PTR);
 }
 
+CExprPtr const& CVarDecl::init() const
+{
+    return M_INIT_VAL;
+}
+
 CExprPtr CVarDecl::expr() const
 {
     return id();
 }
 
+CStmtPtr CVarDecl::simplify_impl() const
+{
+    auto init = modelcheck::simplify(M_INIT_VAL);
+    if (init == M_INIT_VAL) return nullptr;
+    return make_shared<CVarDecl>(M_TYPE, M_NAME, M_IS_PTR, move(init));
+}
+
 void CVarDecl::print_impl(ostream & _out) const
 {
     _out << M_TYPE << (M_IS_PTR ? "*" : " ") << M_NAME;
@@ -304,6 +555,39 @@ void CIf::print_impl(ostream & _out) const
     if (M_FALSE_STMT) _out << "else " << *M_FALSE_STMT;
 }
 
+CStmtPtr CIf::simplify_impl() const
+{
+    auto cond = modelcheck::simplify(M_COND);
+
+    // Prunes the branch which is never taken.
+    long long int val;
+    if (cond->is_constant(val))
+    {
+        if (val) return modelcheck::simplify(M_TRUE_STMT);
+        if (M_FALSE_STMT) return modelcheck::simplify(M_FALSE_STMT);
+        return make_shared<CBlock>(CBlockList{});
+    }
+
+    auto true_stmt = modelcheck::simplify(M_TRUE_STMT);
+    auto false_stmt = modelcheck::simplify(M_FALSE_STMT);
+
+    auto false_block = dynamic_pointer_cast<CBlock>(false_stmt);
+    if (false_block && false_block->stmts().empty()) false_stmt = nullptr;
+
+    if (cond == M_COND && true_stmt == M_TRUE_STMT && false_stmt == M_FALSE_STMT)
+    {
+        return nullptr;
+    }
+
+    // An else branch must not be captured by a nested if statement.
+    if (false_stmt && dynamic_pointer_cast<CIf>(true_stmt))
+    {
+        true_stmt = make_shared<CBlock>(CBlockList{true_stmt});
+    }
+
+    return make_shared<CIf>(move(cond), move(true_stmt), move(false_stmt));
+}
+
 // -------------------------------------------------------------------------- //
 
 CWhileLoop::CWhileLoop(CStmtPtr _body, CExprPtr _cond, bool _atleast_once)
@@ -324,6 +608,21 @@ void CWhileLoop::print_impl(ostream & _out) const
     }
 }
 
+CStmtPtr CWhileLoop::simplify_impl() const
+{
+    auto cond = modelcheck::simplify(M_COND);
+
+    long long int val;
+    if (!M_IS_DO_WHILE && cond->is_constant(val) && val == 0)
+    {
+        return make_shared<CBlock>(CBlockList{});
+    }
+
+    auto body = modelcheck::simplify(M_BODY);
+    if (cond == M_COND && body == M_BODY) return nullptr;
+    return make_shared<CWhileLoop>(move(body), move(cond), M_IS_DO_WHILE);
+}
+
 // -------------------------------------------------------------------------- //
 
 CForLoop::CForLoop(
@@ -349,14 +648,44 @@ void CForLoop::print_impl(ostream & _out) const
     _out << ")" << *M_BODY;
 }
 
+CStmtPtr CForLoop::simplify_impl() const
+{
+    auto cond = modelcheck::simplify(M_COND);
+
+    long long int val;
+    if (cond && cond->is_constant(val))
+    {
+        if (val == 0 && !M_INIT) return make_shared<CBlock>(CBlockList{});
+        if (val != 0) cond = nullptr;
+    }
+
+    // Empty blocks are not valid within the loop header.
+    auto init = modelcheck::simplify(M_INIT);
+    auto init_block = dynamic_pointer_cast<CBlock>(init);
+    if (init_block && init_block->stmts().empty()) init = nullptr;
+
+    auto loop = modelcheck::simplify(M_LOOP);
+    auto loop_block = dynamic_pointer_cast<CBlock>(loop);
+    if (loop_block && loop_block->stmts().empty()) loop = nullptr;
+
+    auto body = modelcheck::simplify(M_BODY);
+
+    if (init == M_INIT && cond == M_COND && loop == M_LOOP && body == M_BODY)
+    {
+        return nullptr;
+    }
+    return make_shared<CForLoop>(
+        move(init), move(cond), move(loop), move(body)
+    );
+}
+
 // -------------------------------------------------------------------------- //
 
 CSwitch::CSwitch(CExprPtr _cond): CSwitch(_cond, {make_shared<CBreak>()}) {}
 
 CSwitch::CSwitch(CExprPtr _cond, CBlockList _default)
-: m_cond(_cond), m_default(move(_default))
+: M_COND(move(_cond)), m_default(move(_default))
 {
-    m_cond.nest();
     nest();
 }
 
@@ -369,7 +698,7 @@ size_t CSwitch::size() const { return m_cases.size(); }
 
 void CSwitch::print_impl(ostream & _out) const
 {
-    _out << "switch(" << m_cond << "){";
+    _out << "switch(" << *M_COND << "){";
     for (auto const switch_case : m_cases)
     {
         _out << "case " << switch_case.first << ":" << switch_case.second;
@@ -377,6 +706,25 @@ void CSwitch::print_impl(ostream & _out) const
     _out << "default:" << m_default << "}";
 }
 
+CStmtPtr CSwitch::simplify_impl() const
+{
+    auto default_block = dynamic_pointer_cast<CBlock>(
+        modelcheck::simplify(make_shared<CBlock>(m_default))
+    );
+
+    auto result = make_shared<CSwitch>(
+        modelcheck::simplify(M_COND), default_block->stmts()
+    );
+    for (auto const& switch_case : m_cases)
+    {
+        auto case_block = dynamic_pointer_cast<CBlock>(
+            modelcheck::simplify(make_shared<CBlock>(switch_case.second))
+        );
+        result->add_case(switch_case.first, case_block->stmts());
+    }
+    return result;
+}
+
 // -------------------------------------------------------------------------- //
 
 void CBreak::print_impl(ostream & _out) const { _out << "break"; }
@@ -387,6 +735,15 @@ void CContinue::print_impl(ostream & _out) const { _out << "continue"; }
 
 CReturn::CReturn(CExprPtr _retval): m_retval(move(_retval)) {}
 
+CExprPtr const& CReturn::retval() const { return m_retval; }
+
+CStmtPtr CReturn::simplify_impl() const
+{
+    auto retval = modelcheck::simplify(m_retval);
+    if (retval == m_retval) return nullptr;
+    return make_shared<CReturn>(move(retval));
+}
+
 void CReturn::print_impl(ostream & _out) const
 {
     _out << "return";
@@ -406,12 +763,22 @@ CFuncDef::CFuncDef(
     for (auto arg : M_ARGS) arg->nest();
 }
 
+CFuncDef CFuncDef::simplify() const
+{
+    auto body = dynamic_pointer_cast<CBlock>(modelcheck::simplify(M_BODY));
+    return CFuncDef(M_ID, M_ARGS, move(body), M_MOD);
+}
+
 void CFuncDef::print(ostream & _out) const
 {
     if (M_MOD == Modifier::INLINE)
     {
         _out << "static inline ";
     }
+    else if (M_MOD == Modifier::ALWAYS_INLINE)
+    {
+        _out << "SOL_ALWAYS_INLINE ";
+    }
     else if (M_MOD == Modifier::EXTERN)
     {
         _out << "extern ";
@@ -82,6 +82,7 @@ public:
     ~CBinaryOp() = default;
 
     void print(std::ostream & _out) const override;
+    CExprPtr simplify() const override;
 
     // Converts this standalone call into a statement.
     CStmtPtr stmt();
@@ -90,6 +91,15 @@ private:
     CExprPtr const M_LHS;
     CExprPtr const M_RHS;
     std::string const M_OP;
+
+    // If (_lhs)_op(_rhs) is defined and in range, then its value is written to
+    // _res and true is returned. Otherwise, false is returned.
+    static bool fold(
+        long long int _lhs,
+        std::string const& _op,
+        long long int _rhs,
+        long long int & _res
+    );
 };
 
 /**
@@ -119,6 +129,7 @@ public:
     ~CMemberAccess() = default;
 
     void print(std::ostream & _out) const override;
+    CExprPtr simplify() const override;
 
 protected:
     CExprPtr expr() const override;
@@ -146,6 +157,9 @@ public:
     void print(std::ostream & _out) const override;
     bool is_pointer() const override;
 
+    // Returns the name of this identifier.
+    std::string const& name() const;
+
 protected:
     CExprPtr expr() const override;
 
@@ -168,6 +182,7 @@ public:
     ~CIntLiteral() = default;
 
     void print(std::ostream & _out) const override;
+    bool is_constant(long long int & _val) const override;
 
 private:
     long long int const M_VAL;
@@ -210,6 +225,10 @@ public:
 
     void print(std::ostream & _out) const override;
 
+    // Only arithmetic and logical prefix operators are simplified, as all other
+    // operators are applied to lvalues.
+    CExprPtr simplify() const override;
+
     // Converts this standalone call into a statement.
     CStmtPtr stmt();
 
@@ -256,6 +275,7 @@ public:
 
     void print(std::ostream & _out) const override;
     bool is_pointer() const override;
+    CExprPtr simplify() const override;
 
     // Converts this standalone call into a statement.
     CStmtPtr stmt();
@@ -281,6 +301,7 @@ public:
 
     void print(std::ostream & _out) const override;
     bool is_pointer() const override;
+    CExprPtr simplify() const override;
 
 private:
     CExprPtr const M_EXPR;
@@ -302,6 +323,7 @@ public:
 
     void print(std::ostream & _out) const override;
     bool is_pointer() const override;
+    CExprPtr simplify() const override;
 
     // Converts this standalone call into a statement.
     CStmtPtr stmt();
@@ -362,10 +384,25 @@ public:
 
     ~CBlock() = default;
 
+    // Returns the statements of this block.
+    CBlockList const& stmts() const;
+
+    // Returns true if this block declares a variable in its own scope.
+    bool declares() const;
+
 private:
     CBlockList const M_STMTS;
 
     void print_impl(std::ostream & _out) const override;
+
+    // Simplifies each statement, then splices in all nested blocks which do
+    // not declare variables, and then removes all unreachable statements. If a
+    // temporary is returned immediately after its declaration, then its
+    // initial value is returned instead.
+    CStmtPtr simplify_impl() const override;
+
+    // Returns true if control never reaches the end of _stmt.
+    static bool is_jump(CStmtPtr const& _stmt);
 };
 
 // -------------------------------------------------------------------------- //
@@ -385,6 +422,7 @@ private:
     CExprPtr const M_EXPR;
 
     void print_impl(std::ostream & _out) const override;
+    CStmtPtr simplify_impl() const override;
 };
 
 // -------------------------------------------------------------------------- //
@@ -406,6 +444,9 @@ public:
     // Generates an identifier for this declaration.
     std::shared_ptr<CIdentifier> id() const;
 
+    // Returns the initial value of this declaration, if any.
+    CExprPtr const& init() const;
+
 protected:
     CExprPtr expr() const override;
 
@@ -416,6 +457,7 @@ private:
     CExprPtr const M_INIT_VAL;
 
     void print_impl(std::ostream & _out) const override;
+    CStmtPtr simplify_impl() const override;
 };
 
 // -------------------------------------------------------------------------- //
@@ -438,6 +480,7 @@ private:
     CStmtPtr const M_FALSE_STMT;
 
     void print_impl(std::ostream & _out) const override;
+    CStmtPtr simplify_impl() const override;
 };
 
 // -------------------------------------------------------------------------- //
@@ -460,6 +503,7 @@ private:
     bool const M_IS_DO_WHILE;
 
     void print_impl(std::ostream & _out) const override;
+    CStmtPtr simplify_impl() const override;
 };
 
 // -------------------------------------------------------------------------- //
@@ -483,6 +527,7 @@ private:
     CStmtPtr const M_BODY;
 
     void print_impl(std::ostream & _out) const override;
+    CStmtPtr simplify_impl() const override;
 };
 
 // -------------------------------------------------------------------------- //
@@ -508,12 +553,16 @@ public:
     ~CSwitch() = default;
 
 private:
-    CExprStmt m_cond;
+    CExprPtr const M_COND;
     CBlock m_default;
 
     std::map<int64_t, CBlock> m_cases;
 
     void print_impl(std::ostream & _out) const override;
+
+    // The arms of a switch are never removed, even if the condition is known,
+    // as a break within an arm is scoped to the switch.
+    CStmtPtr simplify_impl() const override;
 };
 
 // -------------------------------------------------------------------------- //
@@ -555,10 +604,14 @@ public:
 
     ~CReturn() = default;
 
+    // Returns the value returned by this statement, if any.
+    CExprPtr const& retval() const;
+
 private:
     CExprPtr const m_retval;
 
     void print_impl(std::ostream & _out) const override;
+    CStmtPtr simplify_impl() const override;
 };
 
 // -------------------------------------------------------------------------- //
@@ -570,7 +623,7 @@ private:
 class CFuncDef : public CElement
 {
 public:
-    enum class Modifier { DEFAULT, INLINE, EXTERN };
+    enum class Modifier { DEFAULT, INLINE, ALWAYS_INLINE, EXTERN };
 
     // Represents the function, _id.type _id.name(_args[0],...,args[k]){_body}.
     CFuncDef(
@@ -582,6 +635,9 @@ public:
 
     void print(std::ostream & _out) const override;
 
+    // Returns a copy of this definition, with a simplified body.
+    CFuncDef simplify() const;
+
 private:
     std::shared_ptr<CVarDecl> const M_ID;
     CParams const M_ARGS;
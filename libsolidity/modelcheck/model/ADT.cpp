@@ -2,6 +2,7 @@
 
 #include <libsolidity/modelcheck/analysis/AnalysisStack.h>
 #include <libsolidity/modelcheck/analysis/AllocationSites.h>
+#include <libsolidity/modelcheck/analysis/CallState.h>
 #include <libsolidity/modelcheck/analysis/Inheritance.h>
 #include <libsolidity/modelcheck/analysis/Library.h>
 #include <libsolidity/modelcheck/analysis/TypeNames.h>
@@ -41,6 +42,12 @@ void ADTConverter::print(ostream& _stream)
 {
 	ScopedSwap<ostream*> stream_swap(m_ostream, &_stream);
 
+    // Prints the shared call state, if it is used.
+    if (m_stack->environment()->uses_env())
+    {
+        (*m_ostream) << m_stack->environment()->env_struct(M_FORWARD_DECLARE);
+    }
+
     // Prints all libraries first.
     for (auto library : m_stack->libraries()->view())
     {
@@ -104,6 +111,7 @@ void ADTConverter::generate_contract(FlatContract const& _contract)
         for (auto decl : _contract.state_variables())
         {
             if (decl->isConstant()) continue;
+            if (m_stack->hoists(*decl)) continue;
 
             // TODO: flat map to pre-compute the category.
             string type;
@@ -127,9 +135,23 @@ void ADTConverter::generate_contract(FlatContract const& _contract)
     }
 
     // TODO(scottwe): contracts should be able to name themselves.
-    auto name = m_stack->types()->get_name(*_contract.raw());
+    auto const& name = m_stack->types()->get_name(*_contract.raw());
     CStructDef contract(name, move(fields));
     (*m_ostream) << contract;
+
+    // Hoisted variables are declared once, as globals, after their types.
+    if (!M_FORWARD_DECLARE)
+    {
+        for (auto decl : _contract.state_variables())
+        {
+            if (!m_stack->hoists(*decl)) continue;
+            if (!m_built.insert(decl).second) continue;
+
+            string const TYPE = m_stack->types()->get_type(*decl);
+            string const NAME = ContractUtilities::global_name(*decl);
+            (*m_ostream) << CVarDecl("SOL_GLOBAL " + TYPE, NAME);
+        }
+    }
 }
 
 // -------------------------------------------------------------------------- //
@@ -161,7 +183,7 @@ void ADTConverter::generate_structure(Structure const& _structure)
     }
 
     // TODO(scottwe): structures should be able to name themselves.
-    auto name = m_stack->types()->get_name(*_structure.raw());
+    auto const& name = m_stack->types()->get_name(*_structure.raw());
     CStructDef structure(name, move(fields));
     (*m_ostream) << structure;
 }
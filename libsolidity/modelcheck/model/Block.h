@@ -57,6 +57,10 @@ public:
 	// Generates a SimpleCGenerator representation of the Solidity function.
 	std::shared_ptr<CBlock> convert();
 
+	// If _enable is set, then each statement is tagged with a #line directive
+	// for its location in the Solidity source.
+	void set_line_markers(bool _enable);
+
 protected:
 	std::shared_ptr<AnalysisStack const> const m_stack;
 
@@ -118,6 +122,9 @@ private:
 	// Generates the payment call.
 	static void add_value_handler(CBlockList & _block);
 
+	// Tags _stmt with the source location of _node, if line markers are set.
+	void mark(ASTNode const& _node, CStmtPtr _stmt) const;
+
 	Block const& M_BODY;
 
 	bool const M_MANAGE_PAY;
@@ -130,6 +137,7 @@ private:
 	std::shared_ptr<CBlock> m_top_block;
 
 	bool m_is_top_level = true;
+	bool m_line_markers = false;
 };
 
 // -------------------------------------------------------------------------- //
@@ -210,13 +218,32 @@ public:
 		// Returns true if the function had some modifier, which was not
 		// filtered away.
 		bool empty() const;
+
+		// Returns true if no modifier has more than one placeholder. In this
+		// case, the modifier chain can be inlined without duplicating code.
+		bool is_linear() const;
 	
 	private:
+		// Counts the placeholder statements within a modifier definition.
+		class PlaceholderCounter : public ASTConstVisitor
+		{
+		public:
+			size_t count(ModifierDefinition const& _def);
+
+		protected:
+			void endVisit(PlaceholderStatement const&) override;
+
+		private:
+			size_t m_count = 0;
+		};
+
 		FunctionSpecialization const& M_SPEC;
 
 		std::vector<
 			std::pair<ModifierDefinition const*, ModifierInvocation const*>
 		> m_filtered_mods;
+
+		bool m_is_linear = true;
 	};
 
 	~ModifierBlockConverter() override = default;
@@ -60,6 +60,13 @@ shared_ptr<CBlock> GeneralBlockConverter::convert()
 
 // -------------------------------------------------------------------------- //
 
+void GeneralBlockConverter::set_line_markers(bool _enable)
+{
+	m_line_markers = _enable;
+}
+
+// -------------------------------------------------------------------------- //
+
 CExprPtr GeneralBlockConverter::expand(Expression const& _expr, bool _ref)
 {
 	bool const INITS = block_type() == BlockType::Initializer;
@@ -108,6 +115,7 @@ bool GeneralBlockConverter::visit(Block const& _node)
 	for (auto const& stmt : _node.statements())
 	{
 		stmt->accept(*this);
+		mark(*stmt, last_substmt());
 		stmts.push_back(last_substmt());
 	}
 
@@ -279,7 +287,7 @@ bool GeneralBlockConverter::visit(ExpressionStatement const& _node)
 				for (auto entry : call.decl().returnParameters())
 				{
 					string name = "blockvar_" + to_string(tmp_vars.size());
-					auto type = m_stack->types()->get_type(*entry.get());
+					auto const& type = m_stack->types()->get_type(*entry.get());
 					auto decl = make_shared<CVarDecl>(type, name, false);
 					tmp_vars.push_back(decl);
 					stmts.push_back(decl);
@@ -307,7 +315,7 @@ bool GeneralBlockConverter::visit(ExpressionStatement const& _node)
 				for (auto entry : lhs->components())
 				{
 					string name = "blockvar_" + to_string(tmp_vars.size());
-					auto type = m_stack->types()->get_type(*entry.get());
+					auto const& type = m_stack->types()->get_type(*entry.get());
 					auto decl = make_shared<CVarDecl>(type, name, false);
 					tmp_vars.push_back(decl);
 					stmts.push_back(decl);
@@ -410,6 +418,18 @@ void GeneralBlockConverter::add_value_handler(CBlockList & _block)
 
 // -------------------------------------------------------------------------- //
 
+void GeneralBlockConverter::mark(ASTNode const& _node, CStmtPtr _stmt) const
+{
+	if (!m_line_markers || !_stmt) return;
+
+	auto const LOC = source_line(_node);
+	if (LOC.second == 0) return;
+
+	_stmt->mark(make_shared<CLineMarker>(LOC.first, LOC.second));
+}
+
+// -------------------------------------------------------------------------- //
+
 }
 }
 }
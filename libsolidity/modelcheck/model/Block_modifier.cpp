@@ -32,6 +32,7 @@ ModifierBlockConverter::ModifierBlockConverter::Factory::Factory(
         if (auto match = find_named_match<ModifierDefinition>(contract, target))
         {
             m_filtered_mods.push_back(make_pair(match, mod.get()));
+            if (PlaceholderCounter().count(*match) > 1) m_is_linear = false;
         }
     }
 }
@@ -79,6 +80,31 @@ bool ModifierBlockConverter::Factory::empty() const
 
 // -------------------------------------------------------------------------- //
 
+bool ModifierBlockConverter::Factory::is_linear() const
+{
+    return m_is_linear;
+}
+
+// -------------------------------------------------------------------------- //
+
+size_t ModifierBlockConverter::Factory::PlaceholderCounter::count(
+    ModifierDefinition const& _def
+)
+{
+    m_count = 0;
+    _def.body().accept(*this);
+    return m_count;
+}
+
+void ModifierBlockConverter::Factory::PlaceholderCounter::endVisit(
+    PlaceholderStatement const&
+)
+{
+    ++m_count;
+}
+
+// -------------------------------------------------------------------------- //
+
 ModifierBlockConverter::ModifierBlockConverter(
     FunctionDefinition const& _func,
     ModifierDefinition const* _def,
@@ -15,6 +15,7 @@
 #include <libsolidity/modelcheck/utils/Function.h>
 #include <libsolidity/modelcheck/utils/General.h>
 #include <libsolidity/modelcheck/utils/LibVerify.h>
+#include <libsolidity/modelcheck/utils/Primitives.h>
 #include <libsolidity/modelcheck/utils/Types.h>
 
 #include <stdexcept>
@@ -117,8 +118,8 @@ bool ExpressionConverter::visit(Assignment const& _node)
 		{
 			// TODO: "Write" should not be hard-coded.
 			FlatIndex idx(*map);
-			auto record = m_stack->types()->map_db().resolve(idx.decl());
-			generate_mapping_call("Write", move(record), move(idx), move(rhs));
+			auto const& record = m_stack->types()->map_db().resolve(idx.decl());
+			generate_mapping_call("Write", record, move(idx), move(rhs));
 		}
 		else
 		{
@@ -150,18 +151,33 @@ bool ExpressionConverter::visit(TupleExpression const& _node)
 
 bool ExpressionConverter::visit(UnaryOperation const& _node)
 {
-	_node.subExpression().accept(*this);
-
+	auto const& SUBEXPR = _node.subExpression();
+	Token const OP_TOKEN = _node.getOperator();
 	bool const IS_PREFIX = _node.isPrefixOperation();
-	if (_node.getOperator() == Token::Delete)
+	if (OP_TOKEN == Token::Delete)
 	{
 		// TODO(scottwe): Work on dynamic bundles.
 		throw runtime_error("Delete not yet supported.");
 	}
+	else if (OP_TOKEN == Token::Inc || OP_TOKEN == Token::Dec)
+	{
+		generate_step_op(SUBEXPR, OP_TOKEN, IS_PREFIX);
+	}
 	else
 	{
-		string const OP = TokenTraits::friendlyName(_node.getOperator());
-		m_subexpr = make_shared<CUnaryOp>(OP, move(m_subexpr), IS_PREFIX);
+		SUBEXPR.accept(*this);
+
+		string const CHECKED_OP = checked_op_name(SUBEXPR, OP_TOKEN);
+		if (!CHECKED_OP.empty())
+		{
+			CArgList args{ Literals::ZERO, move(m_subexpr) };
+			m_subexpr = make_shared<CFuncCall>(CHECKED_OP, move(args));
+		}
+		else
+		{
+			string const OP = TokenTraits::friendlyName(OP_TOKEN);
+			m_subexpr = make_shared<CUnaryOp>(OP, move(m_subexpr), IS_PREFIX);
+		}
 	}
 
 	return false;
@@ -247,7 +263,7 @@ bool ExpressionConverter::visit(IndexAccess const& _node)
 	case Type::Category::Mapping:
 		{
 			FlatIndex idx(_node);
-			auto record = m_stack->types()->map_db().resolve(idx.decl());
+			auto const& record = m_stack->types()->map_db().resolve(idx.decl());
 
 			if (idx.indices().size() != record.key_types.size())
 			{
@@ -286,11 +302,29 @@ bool ExpressionConverter::visit(Identifier const& _node)
 	{
 		bool const IS_REF = m_stack->types()->is_pointer(_node);
 
-		m_subexpr = make_shared<CIdentifier>(
-			M_DECLS.resolve_identifier(_node), IS_REF
+		// The timestamp is read through the call state, as it may be shared.
+		auto const* MAGIC = dynamic_cast<MagicVariableDeclaration const*>(
+			_node.annotation().referencedDeclaration
 		);
+		auto var_ref = dynamic_cast<VariableDeclaration const *>(_node.annotation().referencedDeclaration);
+		if (MAGIC && MAGIC->name() == "now")
+		{
+			auto const FIELD = CallStateUtilities::Field::Timestamp;
+			m_subexpr = m_stack->environment()->get_field(FIELD);
+		}
+		else if (var_ref && m_stack->hoists(*var_ref))
+		{
+			auto const NAME = ContractUtilities::global_name(*var_ref);
+			m_subexpr = make_shared<CIdentifier>(NAME, IS_REF);
+		}
+		else
+		{
+			m_subexpr = make_shared<CIdentifier>(
+				M_DECLS.resolve_identifier(_node), IS_REF
+			);
+		}
 
-		if (auto var_ref = dynamic_cast<VariableDeclaration const *>(_node.annotation().referencedDeclaration))
+		if (var_ref)
 		{
 			if (var_ref->isReturnParameter())
 			{
@@ -308,6 +342,15 @@ bool ExpressionConverter::visit(Identifier const& _node)
 		else if (is_wrapped_type(*_node.annotation().type))
 		{
 			m_subexpr = make_shared<CMemberAccess>(move(m_subexpr), "v");
+
+			// Narrowed variables are widened on read, to preserve arithmetic.
+			if (!m_lval && var_ref && m_stack->types()->is_narrowed(*var_ref))
+			{
+				auto const& TYPE = unwrap(*var_ref->type());
+				auto const BITS = dynamic_cast<IntegerType const&>(TYPE).numBits();
+				auto const RAW_TYPE = PrimitiveToRaw::integer(BITS, false);
+				m_subexpr = make_shared<CCast>(move(m_subexpr), RAW_TYPE);
+			}
 		}
 	}
 
@@ -393,7 +436,230 @@ void ExpressionConverter::generate_binary_op(
 		throw runtime_error("Unsupported binary operator:" + OP);
 	}
 
-	m_subexpr = make_shared<CBinaryOp>(move(subexpr_1), OP, move(m_subexpr));
+	string const CHECKED_OP = checked_op_name(_lhs, _op, _rhs);
+	if (!CHECKED_OP.empty())
+	{
+		CArgList args{ move(subexpr_1), move(m_subexpr) };
+		m_subexpr = make_shared<CFuncCall>(CHECKED_OP, move(args));
+	}
+	else
+	{
+		m_subexpr = make_shared<CBinaryOp>(
+			move(subexpr_1), OP, move(m_subexpr)
+		);
+	}
+}
+
+void ExpressionConverter::generate_step_op(
+	Expression const& _expr, Token _op, bool _prefix
+)
+{
+	string const CHECKED_OP = checked_op_name(_expr, _op);
+	auto const MAP = LValueSniffer<IndexAccess>(_expr).find();
+
+	// Outside of mappings, unchecked steps are left to C.
+	if (CHECKED_OP.empty() && !MAP)
+	{
+		ScopedSwap<bool> swap(m_lval, true);
+		_expr.accept(*this);
+		string const OP = TokenTraits::friendlyName(_op);
+		m_subexpr = make_shared<CUnaryOp>(OP, move(m_subexpr), _prefix);
+		return;
+	}
+
+	// Otherwise, the next value is computed and then written back.
+	_expr.accept(*this);
+	CExprPtr next;
+	if (!CHECKED_OP.empty())
+	{
+		CArgList args{ move(m_subexpr), Literals::ONE };
+		next = make_shared<CFuncCall>(CHECKED_OP, move(args));
+	}
+	else
+	{
+		string const OP = (_op == Token::Inc ? "+" : "-");
+		next = make_shared<CBinaryOp>(move(m_subexpr), OP, Literals::ONE);
+	}
+
+	if (MAP)
+	{
+		// TODO: the value of a step on a mapping is not yet supported.
+		FlatIndex idx(*MAP);
+		auto const& record = m_stack->types()->map_db().resolve(idx.decl());
+		generate_mapping_call("Write", record, move(idx), move(next));
+		return;
+	}
+
+	{
+		ScopedSwap<bool> swap(m_lval, true);
+		_expr.accept(*this);
+	}
+	m_subexpr = make_shared<CBinaryOp>(move(m_subexpr), "=", move(next));
+
+	// The old value is recovered by undoing the step, which cannot overflow.
+	// This is a call, so no warning is raised if the value is discarded.
+	if (!_prefix)
+	{
+		auto const& TYPE = dynamic_cast<IntegerType const&>(
+			*_expr.annotation().type
+		);
+		auto const UNDO = (_op == Token::Inc ? Token::Sub : Token::Add);
+		auto const BITS = TYPE.numBits();
+		string const INVERSE = checked_op_name(TYPE, UNDO, BITS, BITS);
+		CArgList args{ move(m_subexpr), Literals::ONE };
+		m_subexpr = make_shared<CFuncCall>(INVERSE, move(args));
+	}
+}
+
+string ExpressionConverter::checked_op_name(
+	Expression const& _lhs, Token _op, Expression const& _rhs
+) const
+{
+	if (m_stack->overflow_checks() == OverflowChecks::NONE) return "";
+
+	// Operations over constants are folded by the compiler, and never overflow.
+	auto const* LHS_TYPE = _lhs.annotation().type;
+	auto const RES = LHS_TYPE->binaryOperatorResult(_op, _rhs.annotation().type);
+	auto const* INT_TYPE = dynamic_cast<IntegerType const*>(RES.get());
+	if (!INT_TYPE) return "";
+
+	uint16_t const BITS = INT_TYPE->numBits();
+	return checked_op_name(
+		*INT_TYPE, _op, bit_bound(_lhs, BITS), bit_bound(_rhs, BITS)
+	);
+}
+
+string ExpressionConverter::checked_op_name(
+	Expression const& _expr, Token _op
+) const
+{
+	if (m_stack->overflow_checks() == OverflowChecks::NONE) return "";
+
+	auto const* INT_TYPE = dynamic_cast<IntegerType const*>(
+		_expr.annotation().type
+	);
+	if (!INT_TYPE) return "";
+
+	// A step is checked as _expr +/- 1, and a negation as 0 - _expr.
+	uint16_t const BITS = INT_TYPE->numBits();
+	switch (_op)
+	{
+	case Token::Inc:
+		return checked_op_name(*INT_TYPE, Token::Add, bit_bound(_expr, BITS), 1);
+	case Token::Dec:
+		return checked_op_name(*INT_TYPE, Token::Sub, bit_bound(_expr, BITS), 1);
+	case Token::Sub:
+		return checked_op_name(*INT_TYPE, Token::Sub, 0, BITS);
+	default:
+		return "";
+	}
+}
+
+string ExpressionConverter::checked_op_name(
+	IntegerType const& _type, Token _op, uint16_t _lhs_bits, uint16_t _rhs_bits
+) const
+{
+	auto const MODE = m_stack->overflow_checks();
+	if (MODE == OverflowChecks::NONE) return "";
+
+	string op_name;
+	switch (_op)
+	{
+	case Token::Add:
+		op_name = "add";
+		break;
+	case Token::Sub:
+		op_name = "sub";
+		break;
+	case Token::Mul:
+		op_name = "mul";
+		break;
+	default:
+		return "";
+	}
+
+	// Elides checks on unsigned values which are too small to overflow.
+	uint16_t const BITS = _type.numBits();
+	if (MODE == OverflowChecks::UNPROVEN && !_type.isSigned())
+	{
+		if (_op == Token::Add && max(_lhs_bits, _rhs_bits) + 1 <= BITS)
+		{
+			return "";
+		}
+		else if (_op == Token::Mul && _lhs_bits + _rhs_bits <= BITS)
+		{
+			return "";
+		}
+	}
+
+	string const SYM = (_type.isSigned() ? "int" : "uint");
+	return "sol_" + op_name + "_" + SYM + to_string(BITS);
+}
+
+uint16_t ExpressionConverter::bit_bound(
+	Expression const& _expr, uint16_t _cap
+) const
+{
+	auto const& EXPR = ExpressionCleaner(_expr).clean();
+	auto const* TYPE = EXPR.annotation().type;
+
+	if (auto rational = dynamic_cast<RationalNumberType const*>(TYPE))
+	{
+		if (rational->isFractional() || rational->isNegative()) return _cap;
+
+		auto const VALUE = rational->literalValue(nullptr);
+		uint16_t bits = 0;
+		while (bits < _cap && (VALUE >> bits) != 0) ++bits;
+		return bits;
+	}
+
+	auto const* INT_TYPE = dynamic_cast<IntegerType const*>(TYPE);
+	if (!INT_TYPE || INT_TYPE->isSigned()) return _cap;
+
+	uint16_t bits = min<uint16_t>(INT_TYPE->numBits(), _cap);
+	if (auto id = dynamic_cast<Identifier const*>(&EXPR))
+	{
+		auto const* REF = id->annotation().referencedDeclaration;
+		auto const* VAR = dynamic_cast<VariableDeclaration const*>(REF);
+		if (VAR && m_stack->types()->is_narrowed(*VAR))
+		{
+			bits = min(bits, m_stack->types()->narrowed_width(*VAR));
+		}
+	}
+	else if (auto call = dynamic_cast<FunctionCall const*>(&EXPR))
+	{
+		// Widening conversions preserve the bound of their argument.
+		auto const KIND = call->annotation().kind;
+		if (KIND == FunctionCallKind::TypeConversion)
+		{
+			auto const& ARG = *call->arguments()[0];
+			auto const* ARG_TYPE = ARG.annotation().type;
+			if (ARG_TYPE->isImplicitlyConvertibleTo(*INT_TYPE))
+			{
+				bits = min(bits, bit_bound(ARG, bits));
+			}
+		}
+	}
+	else if (auto op = dynamic_cast<BinaryOperation const*>(&EXPR))
+	{
+		// Nested operations are bounded inductively. If the bound exceeds the
+		// width of the type, the operation has either been checked or wraps.
+		auto const LHS_BITS = bit_bound(op->leftExpression(), bits);
+		auto const RHS_BITS = bit_bound(op->rightExpression(), bits);
+		if (op->getOperator() == Token::Add)
+		{
+			bits = min<uint16_t>(bits, max(LHS_BITS, RHS_BITS) + 1);
+		}
+		else if (op->getOperator() == Token::Mul)
+		{
+			bits = min<uint16_t>(bits, LHS_BITS + RHS_BITS);
+		}
+		else if (op->getOperator() == Token::BitAnd)
+		{
+			bits = min(LHS_BITS, RHS_BITS);
+		}
+	}
+	return bits;
 }
 
 void ExpressionConverter::generate_mapping_call(
@@ -657,7 +923,7 @@ void ExpressionConverter::print_function(FunctionCall const& _call)
 	}
 	else if (group == FunctionCallAnalyzer::CallGroup::Crypto)
 	{
-		m_subexpr = make_shared<CFuncCall>("sol_crypto", CArgList{});
+		print_crypto(_call);
 	}
 	else if (group == FunctionCallAnalyzer::CallGroup::Destruct)
 	{
@@ -685,13 +951,11 @@ void ExpressionConverter::print_function(FunctionCall const& _call)
 	}
 	else if (group == FunctionCallAnalyzer::CallGroup::AddMod)
 	{
-		// TODO(scottwe): overflow free `assert(z > 0); return (x + y) % z;`.
-		throw runtime_error("AddMod not yet supported.");
+		print_modular(true, _call.arguments());
 	}
 	else if (group == FunctionCallAnalyzer::CallGroup::MulMod)
 	{
-		// TODO(scottwe): overflow free `assert(z > 0); return (x * y) % z;`.
-		throw runtime_error("MulMod not yet supported.");
+		print_modular(false, _call.arguments());
 	}
 	else if (group == FunctionCallAnalyzer::CallGroup::Push)
 	{
@@ -893,6 +1157,126 @@ void ExpressionConverter::print_property(bool _fail, SolArgList const& _args)
 	}
 }
 
+void ExpressionConverter::print_modular(bool _add, SolArgList const& _args)
+{
+	// The intermediate value is computed exactly by libverify.
+	CArgList args;
+	for (auto arg : _args)
+	{
+		ExpressionConverter operand(*arg, m_stack, M_DECLS, false, m_is_init);
+		args.push_back(operand.convert());
+	}
+
+	if (_add)
+	{
+		m_subexpr = LibVerify::addmod(args[0], args[1], args[2]);
+	}
+	else
+	{
+		m_subexpr = LibVerify::mulmod(args[0], args[1], args[2]);
+	}
+}
+
+void ExpressionConverter::print_crypto(FunctionCall const& _call)
+{
+	FunctionCallAnalyzer calldata(_call);
+	auto const KIND = calldata.type().kind();
+
+	// Collects the words hashed, along with the width of each word.
+	SolArgList words;
+	bool packed = false;
+	if (KIND == FunctionType::Kind::ECRecover)
+	{
+		words = _call.arguments();
+	}
+	else if (!_call.arguments().empty())
+	{
+		auto const& ARG = ExpressionCleaner(*_call.arguments()[0]).clean();
+		if (auto encoding = dynamic_cast<FunctionCall const*>(&ARG))
+		{
+			FunctionCallAnalyzer encdata(*encoding);
+			auto const ENC_KIND = encdata.type().kind();
+			if (ENC_KIND == FunctionType::Kind::ABIEncodePacked)
+			{
+				words = encoding->arguments();
+				packed = true;
+			}
+			else if (ENC_KIND == FunctionType::Kind::ABIEncode)
+			{
+				words = encoding->arguments();
+			}
+		}
+	}
+
+	// If the input is not a sequence of words, the hash is overapproximated.
+	bool is_modeled = !words.empty();
+	for (auto word : words)
+	{
+		auto const* TYPE = word->annotation().type;
+		if (TYPE->mobileType()) TYPE = TYPE->mobileType();
+		is_modeled = is_modeled && is_simple_type(*TYPE);
+	}
+	if (!is_modeled)
+	{
+		m_subexpr = make_shared<CFuncCall>("sol_crypto", CArgList{});
+		return;
+	}
+
+	CExprPtr prefix;
+	for (auto word : words)
+	{
+		auto const* TYPE = word->annotation().type;
+		if (TYPE->mobileType()) TYPE = TYPE->mobileType();
+
+		// Without packing, bytesN is left-aligned, and so is padded by zeros.
+		size_t bytes = 32;
+		size_t padding = 0;
+		if (packed)
+		{
+			bytes = simple_bit_count(*TYPE) / 8;
+		}
+		else if (TYPE->category() == Type::Category::FixedBytes)
+		{
+			bytes = simple_bit_count(*TYPE) / 8;
+			padding = 32 - bytes;
+		}
+
+		ExpressionConverter conv(*word, m_stack, M_DECLS, false, m_is_init);
+		prefix = LibVerify::hash_push(move(prefix), conv.convert(), bytes);
+		if (padding > 0)
+		{
+			auto zero = make_shared<CIntLiteral>(0);
+			prefix = LibVerify::hash_push(move(prefix), move(zero), padding);
+		}
+	}
+
+	string fn;
+	switch (KIND)
+	{
+	case FunctionType::Kind::KECCAK256:
+		fn = "KECCAK256";
+		break;
+	case FunctionType::Kind::SHA256:
+		fn = "SHA256";
+		break;
+	case FunctionType::Kind::RIPEMD160:
+		fn = "RIPEMD160";
+		break;
+	default:
+		fn = "ECRECOVER";
+		break;
+	}
+	m_subexpr = LibVerify::hash_final(fn, move(prefix));
+
+	// Digests narrower than a word (ripemd160, ecrecover) are truncated.
+	auto const BITS = simple_bit_count(*_call.annotation().type);
+	if (BITS < 256)
+	{
+		auto const RAW_TYPE = PrimitiveToRaw::integer(BITS, false);
+		m_subexpr = make_shared<CCast>(move(m_subexpr), RAW_TYPE);
+	}
+}
+
 // -------------------------------------------------------------------------- //
 
 void ExpressionConverter::pass_next_call_state(
@@ -975,8 +1359,7 @@ void ExpressionConverter::print_adt_member(
 void ExpressionConverter::print_magic_member(TypePointer _t, string _member)
 {
 	auto const TYPE = CallStateUtilities::parse_magic_type(*_t, move(_member));
-	auto name = CallStateUtilities::get_name(TYPE);
-	m_subexpr = make_shared<CIdentifier>(move(name), false);
+	m_subexpr = m_stack->environment()->get_field(TYPE);
 }
 
 void ExpressionConverter::print_enum_member(TypePointer _t, string const& _val)
@@ -95,6 +95,32 @@ private:
 		Expression const& _lhs, Token _op, Expression const& _rhs
 	);
 
+	// Helper to format ++ and --. If the step is checked, or applied to a
+	// mapping, then the next value is computed and written back.
+	void generate_step_op(Expression const& _expr, Token _op, bool _prefix);
+
+	// Returns the name of the libverify helper which checks _lhs _op _rhs for
+	// overflow. If the operation is not checked, an empty string is returned.
+	std::string checked_op_name(
+		Expression const& _lhs, Token _op, Expression const& _rhs
+	) const;
+
+	// Analogous to the above, for the unary operation _op _expr.
+	std::string checked_op_name(Expression const& _expr, Token _op) const;
+
+	// Analogous to the above, given the result type and the bit bounds of each
+	// operand.
+	std::string checked_op_name(
+		IntegerType const& _type,
+		Token _op,
+		uint16_t _lhs_bits,
+		uint16_t _rhs_bits
+	) const;
+
+	// Returns the smallest b such that all values of _expr fit in b bits, as
+	// far as can be determined syntactically. The result is at most _cap.
+	uint16_t bit_bound(Expression const& _expr, uint16_t _cap) const;
+
 	// Helper to format mapping operations.
 	void generate_mapping_call(
 		std::string const& _op,
@@ -137,6 +163,8 @@ private:
 	void print_require(CExprPtr _expr, std::string const& _msg);
 	void print_revert();
 	void print_property(bool _fail, SolArgList const& _args);
+	void print_modular(bool _add, SolArgList const& _args);
+	void print_crypto(FunctionCall const& _call);
 	void pass_next_call_state(
 		FunctionCallAnalyzer const& _call,
 		CFuncCallBuilder & _builder,
@@ -41,11 +41,17 @@ FunctionConverter::FunctionConverter(
     bool _add_sums,
     size_t _map_k,
     View _view,
-    bool _fwd_dcl
+    bool _fwd_dcl,
+    bool _inline_mods,
+    bool _line_markers,
+    bool _simplify
 ): M_ADD_SUMS(_add_sums)
  , M_MAP_K(_map_k)
  , M_VIEW(_view)
  , M_FWD_DCL(_fwd_dcl)
+ , M_INLINE_MODS(_inline_mods)
+ , M_LINE_MARKERS(_line_markers)
+ , M_SIMPLIFY(_simplify)
  , m_stack(_stack)
 {
 }
@@ -132,9 +138,19 @@ CParams FunctionConverter::generate_params(
     // Pushes environment variables, while respecting scope rules.
     if (is_scoped)
     {
+        if (is_contract && m_stack->environment()->uses_env())
+        {
+            params.push_back(make_shared<CVarDecl>(
+                "struct " + CallStateUtilities::ENV_STRUCT,
+                CallStateUtilities::ENV_PARAM,
+                true
+            ));
+        }
+
         for (auto const& fld: m_stack->environment()->order())
         {
             if (!is_contract && fld.contract_only) continue;
+            if (fld.in_env) continue;
             params.push_back(make_shared<CVarDecl>(
                 fld.type_name, fld.name, false
             ));
@@ -188,16 +204,41 @@ CParams FunctionConverter::generate_params(
 
 // -------------------------------------------------------------------------- //
 
+void FunctionConverter::mark(ASTNode const& _node)
+{
+    if (!M_LINE_MARKERS || M_FWD_DCL) return;
+
+    auto const LOC = source_line(_node);
+    if (LOC.second == 0) return;
+
+    (*m_ostream) << CLineMarker(LOC.first, LOC.second);
+}
+
+void FunctionConverter::emit(CFuncDef const& _def)
+{
+    if (M_SIMPLIFY)
+    {
+        (*m_ostream) << _def.simplify();
+    }
+    else
+    {
+        (*m_ostream) << _def;
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
 void FunctionConverter::generate_mapping(Mapping const& _mapping)
 {
     if (M_VIEW == View::EXT) return;
     if (!m_visited.insert(make_pair(&_mapping, nullptr)).second) return;
 
+    mark(_mapping);
     MapGenerator gen(_mapping, M_ADD_SUMS, M_MAP_K, *m_stack->types());
-    (*m_ostream) << gen.declare_zero_initializer(M_FWD_DCL)
-                 << gen.declare_read(M_FWD_DCL)
-                 << gen.declare_write(M_FWD_DCL)
-                 << gen.declare_set(M_FWD_DCL);
+    emit(gen.declare_zero_initializer(M_FWD_DCL));
+    emit(gen.declare_read(M_FWD_DCL));
+    emit(gen.declare_write(M_FWD_DCL));
+    emit(gen.declare_set(M_FWD_DCL));
 }
 
 // -------------------------------------------------------------------------- //
@@ -261,7 +302,9 @@ void FunctionConverter::generate_structure(Structure const& _struct)
     CFuncDef zero(initdata.default_id(), CParams{}, move(zero_body));
     CFuncDef init(initdata.call_id(), move(init_params), move(init_body));
 
-    (*m_ostream) << zero << init;
+    mark(*_struct.raw());
+    emit(zero);
+    emit(init);
 }
 
 // -------------------------------------------------------------------------- //
@@ -413,23 +456,21 @@ string FunctionConverter::handle_contract_initializer(
 
             if (decl->isConstant()) continue;
 
-            auto const NAME = VariableScopeResolver::rewrite(
-                decl->name(), false, VarContext::STRUCT
-            );
-
             CExprPtr v0;
             if (decl->value())
             {
                 v0 = ExpressionConverter(*decl->value(), m_stack, {}).convert();
-                v0 = InitFunction::wrap(*decl->type(), move(v0));
+                v0 = m_stack->types()->wrap(*decl, move(v0));
             }
             else
             {
                 v0 = m_stack->types()->get_init_val(*decl);
             }
 
-            auto member = self_ptr->access(NAME);
-            stmts.push_back(member->assign(move(v0))->stmt());
+            auto member = ContractUtilities::state_member(
+                *m_stack, self_ptr, *decl
+            );
+            stmts.push_back(make_shared<CAssign>(member, move(v0))->stmt());
         }
         if (LOCAL_CTOR)
         {
@@ -454,7 +495,8 @@ string FunctionConverter::handle_contract_initializer(
 
     auto id = make_shared<CVarDecl>("void", NAME);
     CFuncDef init(id, move(params), move(body));
-    (*m_ostream) << init;
+    mark(_initialized);
+    emit(init);
 
     return NAME;
 }
@@ -480,9 +522,18 @@ string FunctionConverter::handle_function(
     // Filters modifiers from constructors.
     ModifierBlockConverter::Factory mods(_spec);
 
+    // All calls after the entry point are local to the modifier chain. If the
+    // chain is inlined, these calls need not be forward declared. The links are
+    // inlined even without optimization, as the KLEE and fuzzer builds disable
+    // it.
+    bool const INLINE_CHAIN = M_INLINE_MODS && !mods.empty() && mods.is_linear();
+    auto const LINK_MOD = (INLINE_CHAIN ? CFuncDef::Modifier::ALWAYS_INLINE
+                                        : CFuncDef::Modifier::DEFAULT);
+
     // Generates a declaration for the base call.
     auto const CONTEXT = VarContext::FUNCTION;
     vector<CFuncDef> defs;
+    if (!M_FWD_DCL || !INLINE_CHAIN)
     {
         CParams params = generate_params(
             rvs, FUNC.parameters(), &USER, dest, CONTEXT
@@ -493,12 +544,13 @@ string FunctionConverter::handle_function(
         {
             FunctionBlockConverter cov(FUNC, m_stack);
             cov.set_for(_spec);
+            cov.set_line_markers(M_LINE_MARKERS);
             body = cov.convert();
         }
 
         string base_fname = _spec.name(mods.len());
         auto id = make_shared<CVarDecl>(_rv_type, move(base_fname), _rv_is_ptr);
-        defs.emplace_back(id, move(params), move(body));
+        defs.emplace_back(id, move(params), move(body), LINK_MOD);
     }
 
     // Generates a declaration for each modifier.
@@ -508,21 +560,26 @@ string FunctionConverter::handle_function(
     for (size_t i = mods.len(); i > 0; --i)
     {
         size_t const IDX = i - 1;
+        if (M_FWD_DCL && INLINE_CHAIN && IDX > 0) continue;
 
         shared_ptr<CBlock> body;
         if (!M_FWD_DCL)
         {
-            body = mods.generate(IDX, m_stack).convert();
+            auto cov = mods.generate(IDX, m_stack);
+            cov.set_line_markers(M_LINE_MARKERS);
+            body = cov.convert();
         }
 
+        auto const MOD = (IDX > 0 ? LINK_MOD : CFuncDef::Modifier::DEFAULT);
         auto id = make_shared<CVarDecl>(_rv_type, _spec.name(IDX), _rv_is_ptr);
-        defs.emplace_back(id, mod_params, move(body));
+        defs.emplace_back(id, mod_params, move(body), MOD);
     }
 
     // Prints each declaration.
     for (auto const& def : defs)
     {
-        (*m_ostream) << def;
+        mark(FUNC);
+        emit(def);
     }
 
     return _spec.name(0);
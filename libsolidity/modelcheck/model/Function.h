@@ -42,13 +42,21 @@ public:
 	// Specifies the class of methods to print.
 	enum class View { FULL, INT, EXT };
 
-    // Constructs a printer for all functions in the model.
+    // Constructs a printer for all functions in the model. If _inline_mods is
+	// set, then each link in a modifier chain (other than its entry point) is
+	// emitted as static inline, provided that no modifier in the chain expands
+	// its placeholder more than once. If _line_markers is set, then each
+	// function and statement is tagged with its location in the Solidity source.
+	// If _simplify is set, then each function body is simplified when printed.
     FunctionConverter(
 		std::shared_ptr<AnalysisStack> _stack,
 		bool _add_sums,
 		size_t _map_k,
 		View _view,
-		bool _forward_declare
+		bool _forward_declare,
+		bool _inline_mods = false,
+		bool _line_markers = false,
+		bool _simplify = false
     );
 
     // Prints all user-defined functions, and implicit utility functions such as
@@ -65,6 +73,9 @@ private:
 
 	View const M_VIEW;
 	bool const M_FWD_DCL;
+	bool const M_INLINE_MODS;
+	bool const M_LINE_MARKERS;
+	bool const M_SIMPLIFY;
 
 	std::shared_ptr<AnalysisStack> m_stack;
 
@@ -82,6 +93,13 @@ private:
 		bool _instrumeneted = false
 	);
 
+	// If line markers are enabled, attributes all code which follows to the
+	// source location of _node.
+	void mark(ASTNode const& _node);
+
+	// Prints _def, simplifying it first if required.
+	void emit(CFuncDef const& _def);
+
 	// Writes all utility methods associated with _mapping.
 	void generate_mapping(Mapping const& _mapping);
 
@@ -62,25 +62,31 @@ CStructDef MapGenerator::declare(bool _forward_declare) const
             t->push_back(make_shared<CVarDecl>(M_VAL_T, "sum"));
         }
 
-        if (M_LEN > 0)
+        for (auto const& entry : entries())
         {
-            KeyIterator indices(M_LEN, M_MAP_RECORD.key_types.size());
-            do
-            {
-                string suffix = indices.suffix();
-
-                if (indices.is_full())
-                {
-                    t->push_back(make_shared<CVarDecl>(
-                        M_VAL_T, "data" + suffix)
-                    );
-                }
-            } while (indices.next());
+            t->push_back(make_shared<CVarDecl>(M_VAL_T, entry));
         }
     }
     return CStructDef(M_MAP_RECORD.name, move(t));
 }
 
+vector<string> MapGenerator::entries() const
+{
+    vector<string> names;
+    if (M_LEN > 0)
+    {
+        KeyIterator indices(M_LEN, M_MAP_RECORD.key_types.size());
+        do
+        {
+            if (indices.is_full())
+            {
+                names.push_back("data" + indices.suffix());
+            }
+        } while (indices.next());
+    }
+    return names;
+}
+
 // -------------------------------------------------------------------------- //
 
 CFuncDef MapGenerator::declare_zero_initializer(bool _forward_declare) const
@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace dev
 {
@@ -49,6 +50,9 @@ public:
     CFuncDef declare_read(bool _forward_declare) const;
     CFuncDef declare_set(bool _forward_declare) const;
 
+    // Returns the name of each data member in the map, in declaration order.
+    std::vector<std::string> entries() const;
+
 private:
     // Utility to iterate all key combinations.
     class KeyIterator
@@ -91,7 +95,7 @@ private:
 
     // Allows types to be resolved.
     TypeAnalyzer const& M_CONVERTER;
-    MapDeflate::FlatMap const M_MAP_RECORD;
+    MapDeflate::FlatMap const& M_MAP_RECORD;
 
     // Const type names to simplify generation.
     std::string const M_VAL_T;
@@ -31,7 +31,7 @@ Actor::Actor(
     std::shared_ptr<FlatContract const> _contract,
     size_t _id,
     CExprPtr _path
-): contract(_contract), path(_path)
+): contract(_contract), path(_path), has_children(false)
 {
     // Reserves a unique identifier for the actor.
     decl = make_shared<CVarDecl>(
@@ -75,11 +75,25 @@ ActorModel::ActorModel(
             
             for (auto path : entry.paths)
             {
-                CExprPtr addr = actor.decl->id();
-                for (auto id : path)
+                // The head of each path is a state variable, which may be
+                // hoisted. The tail is a chain of structure fields.
+                CExprPtr addr;
+                for (auto decl : actor.contract->state_variables())
+                {
+                    if (decl->name() != path.front()) continue;
+                    addr = ContractUtilities::state_member(
+                        *m_stack, actor.decl->id(), *decl
+                    );
+                    break;
+                }
+                if (!addr)
+                {
+                    throw runtime_error("Address path without state variable.");
+                }
+                for (auto id = next(path.begin()); id != path.end(); ++id)
                 {
                     auto const NAME = VariableScopeResolver::rewrite(
-                        id, false, VarContext::STRUCT
+                        *id, false, VarContext::STRUCT
                     );
                     addr = make_shared<CMemberAccess>(addr, NAME);
                 }
@@ -117,7 +131,7 @@ void ActorModel::initialize(
         caselog << "[Initializing " << (*actor.decl->id());
         if (actor.has_children) caselog << " and children";
         caselog << "]";
-        LibVerify::log(_block, caselog.str());
+        LibVerify::log(_block, LibVerify::LogLevel::PHASE, caselog.str());
 
         // Populates core constructor arguments.
         auto init = InitFunction(*m_stack->types(), *ctx->raw()).call_builder();
@@ -7,8 +7,8 @@
 #include <libsolidity/modelcheck/utils/Contract.h>
 #include <libsolidity/modelcheck/utils/LibVerify.h>
 
-#include <list>
 #include <memory>
+#include <vector>
 
 using namespace std;
 
@@ -49,11 +49,17 @@ uint64_t AddressSpace::reserve()
 
 void AddressSpace::map_constants(CBlockList & _block) const
 {
-    list<shared_ptr<CIdentifier>> used_so_far;
     if (m_address_data->literals().size() > 1)
     {
-        LibVerify::log(_block, "[Handling constants]");
+        LibVerify::log(
+            _block, LibVerify::LogLevel::PHASE, "[Handling constants]"
+        );
     }
+
+    // Each non-zero literal is assigned a digit of a Lehmer code. The i-th
+    // digit is drawn from [MIN_ADDR, MAX_ADDR - i), so that every choice of
+    // digits is valid.
+    vector<shared_ptr<CIdentifier>> digits;
     for (auto lit : m_address_data->literals())
     {
         auto const NAME = AbstractAddressDomain::literal_name(lit);
@@ -65,18 +71,25 @@ void AddressSpace::map_constants(CBlockList & _block) const
         }
         else
         {
-            auto range = m_nd_reg->range(MIN_ADDR, MAX_ADDR, NAME);
+            auto const UPPER = MAX_ADDR - digits.size();
+            auto range = m_nd_reg->range(MIN_ADDR, UPPER, NAME);
             _block.push_back(decl->assign(move(range))->stmt());
+            digits.push_back(decl);
+        }
+    }
 
-            for (auto otr : used_so_far)
-            {
-                // TODO: bad for fuzzing, though used_so_far is often small.
-                _block.push_back(make_shared<CBinaryOp>(
-                    decl, "!=", otr
-                )->stmt());
-            }
-
-            used_so_far.push_back(decl);
+    // Decodes the Lehmer code into distinct addresses. After decoding, the
+    // i-th literal is the i-th digit's position amongst the addresses not yet
+    // assigned to literals 0 through i-1.
+    for (size_t i = digits.size(); i > 1; --i)
+    {
+        auto const& PIVOT = digits[i - 2];
+        for (size_t j = i - 1; j < digits.size(); ++j)
+        {
+            auto const& DIGIT = digits[j];
+            auto bump = make_shared<CBinaryOp>(DIGIT, ">=", PIVOT);
+            auto next = make_shared<CBinaryOp>(DIGIT, "+", move(bump));
+            _block.push_back(DIGIT->assign(move(next))->stmt());
         }
     }
 }
@@ -0,0 +1,233 @@
+#include <libsolidity/modelcheck/scheduler/Invariants.h>
+
+#include <libsolidity/modelcheck/analysis/AbstractAddressDomain.h>
+#include <libsolidity/modelcheck/analysis/AnalysisStack.h>
+#include <libsolidity/modelcheck/analysis/Inheritance.h>
+#include <libsolidity/modelcheck/analysis/TypeNames.h>
+#include <libsolidity/modelcheck/model/Mapping.h>
+#include <libsolidity/modelcheck/scheduler/ActorModel.h>
+#include <libsolidity/modelcheck/utils/Contract.h>
+#include <libsolidity/modelcheck/utils/LibVerify.h>
+#include <libsolidity/modelcheck/utils/Types.h>
+
+#include <sstream>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+
+// -------------------------------------------------------------------------- //
+
+InvariantGenerator::InvariantGenerator(
+    shared_ptr<AnalysisStack const> _stack, bool _add_sums
+): m_stack(_stack), M_ADD_SUMS(_add_sums)
+{
+}
+
+// -------------------------------------------------------------------------- //
+
+CFuncDef InvariantGenerator::declare_observer(list<Actor> const& _actors) const
+{
+    size_t group = 0;
+    CBlockList body;
+    for (auto const& actor : _actors)
+    {
+        auto const& CONTRACT = *actor.contract;
+        auto const PARAM = make_shared<CIdentifier>(
+            actor.decl->id()->name(), true
+        );
+
+        auto const BAL = PARAM->access(ContractUtilities::balance_member());
+        observe_value(
+            body,
+            BAL,
+            *ContractUtilities::balance_type(),
+            "SOL_OBSERVE_SCALAR",
+            group
+        );
+
+        for (auto decl : CONTRACT.state_variables())
+        {
+            if (decl->isConstant()) continue;
+            observe_variable(body, PARAM, *decl, group);
+        }
+    }
+    return declare_over("sol_state_observe", _actors, move(body));
+}
+
+CFuncDef InvariantGenerator::declare_assume(list<Actor> const& _actors) const
+{
+    CBlockList body;
+    auto const LEMMAS = make_shared<CIdentifier>("SOL_LEMMAS", false);
+    auto const SEA_LEMMAS = make_shared<CIdentifier>("SOL_SEA_LEMMAS", false);
+    LibVerify::add_require(body, LEMMAS, "Mined invariants assumed.");
+    LibVerify::add_require(body, SEA_LEMMAS, "Stored invariants assumed.");
+    return declare_over("sol_assume_lemmas", _actors, move(body));
+}
+
+CFuncDef InvariantGenerator::declare_check(list<Actor> const& _actors) const
+{
+    CBlockList body;
+    auto const LEMMAS = make_shared<CIdentifier>("SOL_LEMMAS", false);
+    auto const SEA_LEMMAS = make_shared<CIdentifier>("SOL_SEA_LEMMAS", false);
+    LibVerify::add_assert(body, LEMMAS, "Mined invariant violated.");
+    LibVerify::add_assert(body, SEA_LEMMAS, "Stored invariant violated.");
+    return declare_over("sol_check_lemmas", _actors, move(body));
+}
+
+// -------------------------------------------------------------------------- //
+
+void InvariantGenerator::observe(
+    CBlockList & _block, list<Actor> const& _actors
+) const
+{
+    _block.push_back(
+        call_over("SOL_ON_SNAPSHOT", "sol_state_observe", _actors)
+    );
+}
+
+void InvariantGenerator::assume(
+    CBlockList & _block, list<Actor> const& _actors
+) const
+{
+    _block.push_back(
+        call_over("SOL_ON_LEMMAS", "sol_assume_lemmas", _actors)
+    );
+}
+
+void InvariantGenerator::check(
+    CBlockList & _block, list<Actor> const& _actors
+) const
+{
+    _block.push_back(
+        call_over("SOL_ON_LEMMAS", "sol_check_lemmas", _actors)
+    );
+}
+
+// -------------------------------------------------------------------------- //
+
+CFuncDef InvariantGenerator::declare_over(
+    string _name, list<Actor> const& _actors, CBlockList _body
+) const
+{
+    CParams params;
+    for (auto const& actor : _actors)
+    {
+        auto const TYPE = m_stack->types()->get_type(*actor.contract->raw());
+        auto const NAME = actor.decl->id()->name();
+        params.push_back(make_shared<CVarDecl>(TYPE, NAME, true));
+    }
+
+    auto id = make_shared<CVarDecl>("void", move(_name));
+    return CFuncDef(id, move(params), make_shared<CBlock>(move(_body)));
+}
+
+CStmtPtr InvariantGenerator::call_over(
+    string _hook, string _name, list<Actor> const& _actors
+)
+{
+    CFuncCallBuilder builder(move(_name));
+    for (auto const& actor : _actors)
+    {
+        CExprPtr id = actor.decl->id();
+        if (!id->is_pointer())
+        {
+            id = make_shared<CReference>(id);
+        }
+        builder.push(id);
+    }
+
+    CArgList args{ builder.merge_and_pop() };
+    return make_shared<CFuncCall>(move(_hook), move(args))->stmt();
+}
+
+// -------------------------------------------------------------------------- //
+
+void InvariantGenerator::observe_variable(
+    CBlockList & _block,
+    CExprPtr _base,
+    VariableDeclaration const& _var,
+    size_t & _group
+) const
+{
+    auto const MEMBER = ContractUtilities::state_member(*m_stack, _base, _var);
+
+    if (auto const* MAPPING = dynamic_cast<Mapping const*>(_var.typeName()))
+    {
+        auto const& TYPES = *m_stack->types();
+        auto const& RECORD = TYPES.map_db().resolve(*MAPPING);
+        auto const& VAL_TYPE = *RECORD.value_type->annotation().type;
+
+        _group += 1;
+        size_t const ENTRY_CT = m_stack->addresses()->size();
+        MapGenerator mapgen(*MAPPING, M_ADD_SUMS, ENTRY_CT, TYPES);
+        for (auto const& entry : mapgen.entries())
+        {
+            auto const DATA = make_shared<CMemberAccess>(MEMBER, entry);
+            observe_value(_block, DATA, VAL_TYPE, "SOL_OBSERVE_ENTRY", _group);
+        }
+
+        if (M_ADD_SUMS && is_simple_type(VAL_TYPE))
+        {
+            auto const SUM = make_shared<CMemberAccess>(MEMBER, "sum");
+            observe_value(_block, SUM, VAL_TYPE, "SOL_OBSERVE_SUM", _group);
+        }
+    }
+    else
+    {
+        observe_value(
+            _block, MEMBER, *_var.type(), "SOL_OBSERVE_SCALAR", _group
+        );
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+void InvariantGenerator::observe_value(
+    CBlockList & _block,
+    CExprPtr _expr,
+    Type const& _type,
+    string const& _kind,
+    size_t & _group
+) const
+{
+    if (is_simple_type(_type))
+    {
+        if (simple_is_signed(_type)) return;
+
+        auto const WORD = make_shared<CMemberAccess>(_expr, "v");
+        ostringstream label;
+        label << *WORD;
+
+        // Scalars are not related through their group.
+        size_t const GROUP = (_kind == "SOL_OBSERVE_SCALAR") ? 0 : _group;
+
+        CArgList args{
+            make_shared<CStringLiteral>(label.str()),
+            make_shared<CIdentifier>(_kind, false),
+            make_shared<CIntLiteral>(GROUP),
+            WORD
+        };
+        auto call = make_shared<CFuncCall>("SOL_OBSERVE", move(args));
+        _block.push_back(call->stmt());
+    }
+    else if (auto const* STRUCT = dynamic_cast<StructType const*>(&_type))
+    {
+        // Struct members are observed as scalars, as they have no sum.
+        for (auto member : STRUCT->structDefinition().members())
+        {
+            observe_variable(_block, _expr, *member, _group);
+        }
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
@@ -0,0 +1,101 @@
+/**
+ * Utilities to mine candidate invariants from concrete executions, and to feed
+ * them back into the model as lemmas. The model reports a snapshot of all actor
+ * state after each transaction. A runtime then proposes invariants which held
+ * in every snapshot. These are written to invariants.h, and are assumed before
+ * each transaction and checked after it.
+ *
+ * @date 2020
+ */
+
+#pragma once
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/modelcheck/codegen/Details.h>
+
+#include <list>
+#include <memory>
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+
+class AnalysisStack;
+struct Actor;
+
+// -------------------------------------------------------------------------- //
+
+/**
+ * Generates sol_state_observe, sol_assume_lemmas and sol_check_lemmas. The
+ * observer reports the balance, unsigned scalars, map entries and map sums of
+ * each actor through SOL_OBSERVE. Each observation is labeled by the C
+ * expression which reads it, so that mined lemmas may be pasted into the lemma
+ * functions as SOL_LEMMAS. The lemmas which make verify translates from stored
+ * Seahorn invariants are pasted in the same way, as SOL_SEA_LEMMAS.
+ */
+class InvariantGenerator
+{
+public:
+    // Generates lemmas over the state of _stack. If _add_sums is set, then the
+    // sum of each map is observed alongside its entries.
+    InvariantGenerator(
+        std::shared_ptr<AnalysisStack const> _stack, bool _add_sums
+    );
+
+    // Defines sol_state_observe over _actors.
+    CFuncDef declare_observer(std::list<Actor> const& _actors) const;
+
+    // Defines sol_assume_lemmas (resp. sol_check_lemmas) over _actors.
+    CFuncDef declare_assume(std::list<Actor> const& _actors) const;
+    CFuncDef declare_check(std::list<Actor> const& _actors) const;
+
+    // Appends to _block a statement which reports a snapshot of _actors.
+    void observe(CBlockList & _block, std::list<Actor> const& _actors) const;
+
+    // Appends to _block a statement which assumes (resp. checks) all lemmas.
+    void assume(CBlockList & _block, std::list<Actor> const& _actors) const;
+    void check(CBlockList & _block, std::list<Actor> const& _actors) const;
+
+private:
+    std::shared_ptr<AnalysisStack const> m_stack;
+
+    bool const M_ADD_SUMS;
+
+    // Declares a function _name, which takes a pointer to each of _actors and
+    // evaluates _body.
+    CFuncDef declare_over(
+        std::string _name, std::list<Actor> const& _actors, CBlockList _body
+    ) const;
+
+    // Returns the call _name(...) over _actors, wrapped in the macro _hook.
+    static CStmtPtr call_over(
+        std::string _hook, std::string _name, std::list<Actor> const& _actors
+    );
+
+    // Observes member _var of _base. Each map is given a unique _group.
+    void observe_variable(
+        CBlockList & _block,
+        CExprPtr _base,
+        VariableDeclaration const& _var,
+        size_t & _group
+    ) const;
+
+    // Observes _expr of type _type as _kind. Signed words, and types which are
+    // not modeled as words, are skipped.
+    void observe_value(
+        CBlockList & _block,
+        CExprPtr _expr,
+        Type const& _type,
+        std::string const& _kind,
+        size_t & _group
+    ) const;
+};
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
@@ -29,13 +29,18 @@ namespace modelcheck
 
 MainFunctionGenerator::MainFunctionGenerator(
     bool _lockstep_time,
+    bool _add_sums,
     shared_ptr<AnalysisStack const> _stack,
-    shared_ptr<NondetSourceRegistry> _nd_reg
+    shared_ptr<NondetSourceRegistry> _nd_reg,
+    bool _simplify
 ): m_stack(_stack)
  , m_nd_reg(_nd_reg)
+ , M_SIMPLIFY(_simplify)
  , m_addrspace(_stack->addresses(), _nd_reg)
  , m_stategen(_stack, _nd_reg, _lockstep_time)
  , m_actors(_stack, _nd_reg)
+ , m_statehash(_stack)
+ , m_invariants(_stack, _add_sums)
 {
 }
 
@@ -46,9 +51,18 @@ void MainFunctionGenerator::print(ostream& _stream)
     // Generates function switch.
     auto next_case = make_shared<CVarDecl>("uint8_t", "next_call");
 
+    // When simplifying, the default case is dropped, as next_call is drawn
+    // from the range of cases.
     CBlockList default_case;
-    string default_err("Model failure, next_call out of bounds.");
-    LibVerify::add_require(default_case, Literals::ZERO, default_err);
+    if (M_SIMPLIFY)
+    {
+        default_case.push_back(make_shared<CBreak>());
+    }
+    else
+    {
+        string default_err("Model failure, next_call out of bounds.");
+        LibVerify::add_require(default_case, Literals::ZERO, default_err);
+    }
 
     auto call_cases = make_shared<CSwitch>(next_case->id(), move(default_case));
     for (auto actor : m_actors.inspect())
@@ -67,9 +81,12 @@ void MainFunctionGenerator::print(ostream& _stream)
     m_addrspace.map_constants(main);
     m_actors.assign_addresses(main, m_addrspace);
     m_actors.initialize(main, m_stategen);
+    m_invariants.check(main, m_actors.inspect());
+    m_invariants.observe(main, m_actors.inspect());
 
     // Generates transactionals loop.
     CBlockList transactionals;
+    m_invariants.assume(transactionals, m_actors.inspect());
     transactionals.push_back(
         make_shared<CFuncCall>("sol_on_transaction", CArgList{})->stmt()
     );
@@ -79,9 +96,14 @@ void MainFunctionGenerator::print(ostream& _stream)
         m_nd_reg->range(0, call_cases->size(), "next_call")
     )->stmt());
     transactionals.push_back(call_cases);
+    m_statehash.report(transactionals, m_actors.inspect());
+    m_invariants.check(transactionals, m_actors.inspect());
+    m_invariants.observe(transactionals, m_actors.inspect());
 
     // Adds transactional loop to end of body.
-    LibVerify::log(main, "[Entering transaction loop]");
+    LibVerify::log(
+        main, LibVerify::LogLevel::PHASE, "[Entering transaction loop]"
+    );
     main.push_back(make_shared<CWhileLoop>(
         make_shared<CBlock>(move(transactionals)),
         make_shared<CFuncCall>("sol_continue", CArgList{}),
@@ -90,7 +112,61 @@ void MainFunctionGenerator::print(ostream& _stream)
 
     // Implements body as a run_model function.
     auto id = make_shared<CVarDecl>("void", "run_model");
-    _stream << CFuncDef(id, CParams{}, make_shared<CBlock>(move(main)));
+    CFuncDef run_model(id, CParams{}, make_shared<CBlock>(move(main)));
+    set<string> unhashable;
+    auto state_hash = m_statehash.declare(m_actors.inspect(), unhashable);
+    auto coverage_hash = m_statehash.declare_coverage(m_actors.inspect());
+    auto observer = m_invariants.declare_observer(m_actors.inspect());
+    auto assume = m_invariants.declare_assume(m_actors.inspect());
+    auto check = m_invariants.declare_check(m_actors.inspect());
+
+    // The hooks are only defined for the runtimes which call them. Any state
+    // which is not hashed would merge distinct states in the explicit runtime,
+    // so such a model is rejected when built for it.
+    print_guarded(_stream, "defined(MC_STATE_HASH)", { coverage_hash });
+    if (!unhashable.empty())
+    {
+        _stream << endl << "#ifdef MC_EXPLICIT_STATE" << endl
+                << "#error \"Unable to hash state of type";
+        for (auto const& type : unhashable) _stream << " " << type;
+        _stream << ".\"" << endl << "#endif" << endl;
+    }
+    print_guarded(_stream, "defined(MC_EXPLICIT_STATE)", { state_hash });
+    print_guarded(_stream, "defined(MC_MINE_INVARIANTS)", { observer });
+    print_guarded(
+        _stream,
+        "defined(MC_USE_INVARIANTS) || defined(MC_USE_SEA_LEMMAS)",
+        { assume, check }
+    );
+    if (M_SIMPLIFY)
+    {
+        _stream << run_model.simplify();
+    }
+    else
+    {
+        _stream << run_model;
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+void MainFunctionGenerator::print_guarded(
+    ostream& _stream, string const& _cond, list<CFuncDef> const& _defs
+) const
+{
+    _stream << endl << "#if " << _cond << endl;
+    for (auto const& def : _defs)
+    {
+        if (M_SIMPLIFY)
+        {
+            _stream << def.simplify();
+        }
+        else
+        {
+            _stream << def;
+        }
+    }
+    _stream << endl << "#endif" << endl;
 }
 
 // -------------------------------------------------------------------------- //
@@ -155,7 +231,9 @@ CBlockList MainFunctionGenerator::build_case(
     }
 
     call_body.push_back(call_builder.merge_and_pop_stmt());
-    LibVerify::log(call_body, "[Call successful]");
+    LibVerify::log(
+        call_body, LibVerify::LogLevel::CALL, "[Call successful]"
+    );
     call_body.push_back(make_shared<CBreak>());
 
     return call_body;
@@ -184,7 +262,7 @@ void MainFunctionGenerator::log_call(
     caselog << ") on " << _id;
     caselog << "]";
 
-    LibVerify::log(_block, caselog.str());
+    LibVerify::log(_block, LibVerify::LogLevel::CALL, caselog.str());
 }
 
 // -------------------------------------------------------------------------- //
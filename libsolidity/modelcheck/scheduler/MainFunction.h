@@ -12,10 +12,14 @@
 #include <libsolidity/modelcheck/codegen/Details.h>
 #include <libsolidity/modelcheck/scheduler/ActorModel.h>
 #include <libsolidity/modelcheck/scheduler/AddressSpace.h>
+#include <libsolidity/modelcheck/scheduler/Invariants.h>
 #include <libsolidity/modelcheck/scheduler/StateGenerator.h>
+#include <libsolidity/modelcheck/scheduler/StateHash.h>
 
+#include <list>
 #include <memory>
 #include <ostream>
+#include <string>
 
 namespace dev
 {
@@ -38,10 +42,14 @@ class MainFunctionGenerator
 {
 public:
     // Constructs a printer for all function forward decl's required by the ast.
+    // If _simplify is set, then the main function is simplified when printed.
+    // If _add_sums is set, then map sums are observed when mining invariants.
     MainFunctionGenerator(
         bool _lockstep_time,
+        bool _add_sums,
         std::shared_ptr<AnalysisStack const> _stack,
-        std::shared_ptr<NondetSourceRegistry> _nd_reg
+        std::shared_ptr<NondetSourceRegistry> _nd_reg,
+        bool _simplify = false
     );
 
     // Prints the main function.
@@ -52,6 +60,8 @@ private:
 
     std::shared_ptr<NondetSourceRegistry> m_nd_reg;
 
+    bool const M_SIMPLIFY;
+
     // Stores data required to handle addresses.
     AddressSpace m_addrspace;
 
@@ -61,6 +71,12 @@ private:
     // Stores data required to handle contract instances.
     ActorModel m_actors;
 
+    // Summarizes the state of all contract instances.
+    StateHashGenerator m_statehash;
+
+    // Reports snapshots of all contract instances, and checks mined lemmas.
+    InvariantGenerator m_invariants;
+
     // For each method on each contract, this will generate a case for the
     // switch block. Note that _args have been initialized first by
     // analyze_decls.
@@ -68,6 +84,14 @@ private:
         FunctionSpecialization const& _spec, std::shared_ptr<CVarDecl const> _id
     );
 
+    // Prints each of _defs, such that they are only compiled if the
+    // preprocessor condition _cond holds.
+    void print_guarded(
+        std::ostream& _stream,
+        std::string const& _cond,
+        std::list<CFuncDef> const& _defs
+    ) const;
+
     // Helper method to format and log a call selection. The log statement is
     // appended to _block and describes an invocation of _call using _id as the
     // context.
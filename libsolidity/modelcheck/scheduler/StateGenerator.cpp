@@ -32,7 +32,21 @@ StateGenerator::StateGenerator(
 
 void StateGenerator::declare(CBlockList & _block) const
 {
-    for (auto const& fld : m_stack->environment()->order())
+    // The environment is allocated once, and then shared by all transactions.
+    auto const ENV = m_stack->environment();
+    if (ENV->uses_env())
+    {
+        auto const ENV_TYPE = "struct " + CallStateUtilities::ENV_STRUCT;
+        auto const ENV_DATA = CallStateUtilities::ENV_PARAM + "_data";
+        auto data = make_shared<CVarDecl>(ENV_TYPE, ENV_DATA);
+        auto ref = make_shared<CReference>(data->id());
+        _block.push_back(data);
+        _block.push_back(make_shared<CVarDecl>(
+            ENV_TYPE, CallStateUtilities::ENV_PARAM, true, ref
+        ));
+    }
+
+    for (auto const& fld : ENV->order())
     {
         // Determines the initial value, given it should be made global at all.
         CExprPtr val;
@@ -51,7 +65,14 @@ void StateGenerator::declare(CBlockList & _block) const
         }
 
         // Initializes the ID.
-        if (val)
+        if (val && fld.in_env)
+        {
+            auto id = make_shared<CMemberAccess>(
+                ENV->get_field(fld.field), "v"
+            );
+            _block.push_back(id->assign(val)->stmt());
+        }
+        else if (val)
         {
             auto id = make_shared<CVarDecl>(fld.type_name, fld.name);
             _block.push_back(id);
@@ -72,9 +93,11 @@ void StateGenerator::update_global(CBlockList & _block) const
         if (fld.field == CallStateUtilities::Field::Block ||
             fld.field == CallStateUtilities::Field::Timestamp)
         {
-            auto state = make_shared<CIdentifier>(fld.name, false);
-            auto step = state->access("v")->assign(m_nd_reg->increase(
-                state->access("v"), M_USE_LOCKSTEP_TIME, fld.name
+            auto state = make_shared<CMemberAccess>(
+                m_stack->environment()->get_field(fld.field), "v"
+            );
+            auto step = state->assign(m_nd_reg->increase(
+                state, M_USE_LOCKSTEP_TIME, fld.name
             ))->stmt();
             step_block_list.push_back(step);
         }
@@ -134,6 +157,17 @@ void StateGenerator::update_local(CBlockList & _block) const
         _block.push_back(decl);
         _block.push_back(decl->access("v")->assign(val)->stmt());
     }
+
+    // Each transaction originates from its sender. Without an environment,
+    // this is handled by CallState::push_state_to.
+    auto const ORIGIN = CallStateUtilities::Field::Origin;
+    if (m_stack->environment()->uses_env())
+    {
+        auto const SENDER = CallStateUtilities::Field::Sender;
+        auto origin = m_stack->environment()->get_field(ORIGIN);
+        auto sender = m_stack->environment()->get_field(SENDER);
+        _block.push_back(make_shared<CAssign>(origin, sender)->stmt());
+    }
 }
 
 // -------------------------------------------------------------------------- //
@@ -0,0 +1,239 @@
+#include <libsolidity/modelcheck/scheduler/StateHash.h>
+
+#include <libsolidity/modelcheck/analysis/AbstractAddressDomain.h>
+#include <libsolidity/modelcheck/analysis/AnalysisStack.h>
+#include <libsolidity/modelcheck/analysis/CallState.h>
+#include <libsolidity/modelcheck/analysis/Inheritance.h>
+#include <libsolidity/modelcheck/analysis/TypeNames.h>
+#include <libsolidity/modelcheck/codegen/Literals.h>
+#include <libsolidity/modelcheck/model/Mapping.h>
+#include <libsolidity/modelcheck/scheduler/ActorModel.h>
+#include <libsolidity/modelcheck/utils/AbstractAddressDomain.h>
+#include <libsolidity/modelcheck/utils/CallState.h>
+#include <libsolidity/modelcheck/utils/Contract.h>
+#include <libsolidity/modelcheck/utils/Types.h>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+
+// -------------------------------------------------------------------------- //
+
+StateHashGenerator::StateHashGenerator(
+    shared_ptr<AnalysisStack const> _stack
+): m_stack(_stack)
+{
+}
+
+// -------------------------------------------------------------------------- //
+
+bool StateHashGenerator::is_persistent(CallStateUtilities::Field _field)
+{
+    return _field == CallStateUtilities::Field::Block
+        || _field == CallStateUtilities::Field::Timestamp;
+}
+
+// -------------------------------------------------------------------------- //
+
+CFuncDef StateHashGenerator::declare(
+    list<Actor> const& _actors, set<string> & _unhashable
+) const
+{
+    auto hash = make_shared<CVarDecl>(
+        "uint64_t", "state_hash", false, Literals::ZERO
+    );
+
+    CParams params;
+    CBlockList body;
+    body.push_back(hash);
+
+    // The block number and timestamp persist between transactions.
+    for (auto const& fld : m_stack->environment()->order())
+    {
+        if (!is_persistent(fld.field)) continue;
+
+        auto param = make_shared<CVarDecl>(fld.type_name, fld.name);
+        params.push_back(param);
+        fold_value(body, hash->id(), param->id(), *fld.type, _unhashable);
+    }
+
+    // Literal addresses are fixed during setup, but may differ between runs.
+    for (auto lit : m_stack->addresses()->literals())
+    {
+        if (lit == 0) continue;
+
+        auto const NAME = AbstractAddressDomain::literal_name(lit);
+        CArgList args{ hash->id(), make_shared<CIdentifier>(NAME, false) };
+        auto mix = make_shared<CFuncCall>("sol_state_mix", move(args));
+        body.push_back(make_shared<CAssign>(hash->id(), mix)->stmt());
+    }
+
+    fold_actors(body, params, hash->id(), _actors, _unhashable);
+    body.push_back(make_shared<CReturn>(hash->id()));
+
+    auto id = make_shared<CVarDecl>("uint64_t", "sol_state_hash");
+    return CFuncDef(id, move(params), make_shared<CBlock>(move(body)));
+}
+
+CFuncDef StateHashGenerator::declare_coverage(list<Actor> const& _actors) const
+{
+    auto hash = make_shared<CVarDecl>(
+        "uint64_t", "coverage_hash", false, Literals::ZERO
+    );
+
+    CParams params;
+    CBlockList body;
+    body.push_back(hash);
+
+    set<string> skipped;
+    fold_actors(body, params, hash->id(), _actors, skipped);
+    body.push_back(make_shared<CReturn>(hash->id()));
+
+    auto id = make_shared<CVarDecl>("uint64_t", "sol_coverage_hash");
+    return CFuncDef(id, move(params), make_shared<CBlock>(move(body)));
+}
+
+// -------------------------------------------------------------------------- //
+
+void StateHashGenerator::report(
+    CBlockList & _block, list<Actor> const& _actors
+) const
+{
+    CFuncCallBuilder state_builder("sol_state_hash");
+    CFuncCallBuilder coverage_builder("sol_coverage_hash");
+    for (auto const& fld : m_stack->environment()->order())
+    {
+        if (!is_persistent(fld.field)) continue;
+        state_builder.push(m_stack->environment()->get_field(fld.field));
+    }
+    for (auto const& actor : _actors)
+    {
+        CExprPtr id = actor.decl->id();
+        if (!id->is_pointer())
+        {
+            id = make_shared<CReference>(id);
+        }
+        state_builder.push(id);
+        coverage_builder.push(id);
+    }
+
+    CArgList args{
+        state_builder.merge_and_pop(), coverage_builder.merge_and_pop()
+    };
+    auto call = make_shared<CFuncCall>("SOL_ON_STATE", move(args));
+    _block.push_back(call->stmt());
+}
+
+// -------------------------------------------------------------------------- //
+
+void StateHashGenerator::fold_actors(
+    CBlockList & _block,
+    CParams & _params,
+    CExprPtr _hash,
+    list<Actor> const& _actors,
+    set<string> & _unhashable
+) const
+{
+    for (auto const& actor : _actors)
+    {
+        auto const& CONTRACT = *actor.contract;
+        auto const TYPE = m_stack->types()->get_type(*CONTRACT.raw());
+        auto const NAME = actor.decl->id()->name();
+
+        auto param = make_shared<CVarDecl>(TYPE, NAME, true);
+        _params.push_back(param);
+
+        auto const BAL = param->access(ContractUtilities::balance_member());
+        fold_value(
+            _block,
+            _hash,
+            BAL,
+            *ContractUtilities::balance_type(),
+            _unhashable
+        );
+
+        for (auto decl : CONTRACT.state_variables())
+        {
+            if (decl->isConstant()) continue;
+            fold_variable(_block, _hash, param->id(), *decl, _unhashable);
+        }
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+void StateHashGenerator::fold_variable(
+    CBlockList & _block,
+    CExprPtr _hash,
+    CExprPtr _base,
+    VariableDeclaration const& _var,
+    set<string> & _unhashable
+) const
+{
+    auto const MEMBER = ContractUtilities::state_member(*m_stack, _base, _var);
+
+    if (auto const* MAPPING = dynamic_cast<Mapping const*>(_var.typeName()))
+    {
+        auto const& TYPES = *m_stack->types();
+        auto const& RECORD = TYPES.map_db().resolve(*MAPPING);
+        auto const& VAL_TYPE = *RECORD.value_type->annotation().type;
+
+        size_t const ENTRY_CT = m_stack->addresses()->size();
+        MapGenerator mapgen(*MAPPING, false, ENTRY_CT, TYPES);
+        for (auto const& entry : mapgen.entries())
+        {
+            auto const DATA = make_shared<CMemberAccess>(MEMBER, entry);
+            fold_value(_block, _hash, DATA, VAL_TYPE, _unhashable);
+        }
+    }
+    else
+    {
+        fold_value(_block, _hash, MEMBER, *_var.type(), _unhashable);
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+void StateHashGenerator::fold_value(
+    CBlockList & _block,
+    CExprPtr _hash,
+    CExprPtr _expr,
+    Type const& _type,
+    set<string> & _unhashable
+) const
+{
+    if (is_simple_type(_type))
+    {
+        CExprPtr word = make_shared<CMemberAccess>(_expr, "v");
+        if (simple_is_signed(_type))
+        {
+            word = make_shared<CCast>(move(word), "sol_raw_uint256_t");
+        }
+
+        CArgList args{ _hash, move(word) };
+        auto mix = make_shared<CFuncCall>("sol_state_mix", move(args));
+        _block.push_back(make_shared<CAssign>(_hash, mix)->stmt());
+    }
+    else if (auto const* STRUCT = dynamic_cast<StructType const*>(&_type))
+    {
+        for (auto member : STRUCT->structDefinition().members())
+        {
+            fold_variable(_block, _hash, _expr, *member, _unhashable);
+        }
+    }
+    else if (_type.category() != Type::Category::Contract)
+    {
+        _unhashable.insert(_type.toString());
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
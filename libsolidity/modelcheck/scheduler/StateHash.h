@@ -0,0 +1,103 @@
+/**
+ * Utility to summarize the state of all actors as a single word. This allows
+ * runtimes to detect when a transaction reaches a new contract state.
+ * 
+ * @date 2020
+ */
+
+#pragma once
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/modelcheck/codegen/Details.h>
+#include <libsolidity/modelcheck/utils/CallState.h>
+
+#include <list>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+
+class AnalysisStack;
+struct Actor;
+
+// -------------------------------------------------------------------------- //
+
+/**
+ * Generates sol_state_hash, which folds the block number and timestamp, each
+ * literal address, and the balance, scalar state variables and map entries of
+ * each actor through sol_state_mix. This is the state identity used by the
+ * explicit-state runtime. Also generates sol_coverage_hash, which folds only
+ * the storage of each actor. This is the coverage signal used by the fuzzer,
+ * as the environment and the literals change without reaching new behaviour.
+ * Nested contracts are hashed as actors of their own, and are not traversed
+ * from their parents.
+ */
+class StateHashGenerator
+{
+public:
+    StateHashGenerator(std::shared_ptr<AnalysisStack const> _stack);
+
+    // Defines sol_state_hash over _actors. The function takes the value of each
+    // persistent call state field, and then a pointer to each actor, in order.
+    // The name of each type of state which cannot be hashed is added to
+    // _unhashable.
+    CFuncDef declare(
+        std::list<Actor> const& _actors, std::set<std::string> & _unhashable
+    ) const;
+
+    // Defines sol_coverage_hash over _actors. The function takes a pointer to
+    // each actor, in order. State which cannot be hashed is skipped.
+    CFuncDef declare_coverage(std::list<Actor> const& _actors) const;
+
+    // Appends to _block a statement which reports the current state hash and
+    // coverage hash.
+    void report(CBlockList & _block, std::list<Actor> const& _actors) const;
+
+private:
+    std::shared_ptr<AnalysisStack const> m_stack;
+
+    // Returns true if _field is carried from one transaction to the next.
+    static bool is_persistent(CallStateUtilities::Field _field);
+
+    // Folds the storage of each actor into _hash, and adds a parameter for each
+    // actor to _params.
+    void fold_actors(
+        CBlockList & _block,
+        CParams & _params,
+        CExprPtr _hash,
+        std::list<Actor> const& _actors,
+        std::set<std::string> & _unhashable
+    ) const;
+
+    // Folds member _var of _base into _hash.
+    void fold_variable(
+        CBlockList & _block,
+        CExprPtr _hash,
+        CExprPtr _base,
+        VariableDeclaration const& _var,
+        std::set<std::string> & _unhashable
+    ) const;
+
+    // Folds _expr of type _type into _hash. Types which are not modeled as
+    // words, or structures of words, are added to _unhashable. Contracts are
+    // hashed as actors, and are skipped.
+    void fold_value(
+        CBlockList & _block,
+        CExprPtr _hash,
+        CExprPtr _expr,
+        Type const& _type,
+        std::set<std::string> & _unhashable
+    ) const;
+};
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
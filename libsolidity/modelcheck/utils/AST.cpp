@@ -1,5 +1,9 @@
 #include <libsolidity/modelcheck/utils/AST.h>
 
+#include <liblangutil/CharStream.h>
+
+#include <boost/filesystem.hpp>
+
 #include <stdexcept>
 
 using namespace std;
@@ -132,6 +136,26 @@ VariableDeclaration const* expr_to_decl(Expression const& _expr)
 
 // -------------------------------------------------------------------------- //
 
+pair<string, size_t> source_line(ASTNode const& _node)
+{
+    auto const& LOC = _node.location();
+    if (!LOC.source || LOC.start < 0) return make_pair("", 0);
+
+    string file = LOC.source->name();
+    boost::system::error_code ec;
+    if (boost::filesystem::is_regular_file(file, ec))
+    {
+        auto const PATH = boost::filesystem::canonical(file, ec);
+        if (!ec) file = PATH.string();
+    }
+
+    int line, col;
+    tie(line, col) = LOC.source->translatePositionToLineColumn(LOC.start);
+    return make_pair(move(file), line + 1);
+}
+
+// -------------------------------------------------------------------------- //
+
 }
 }
 }
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <type_traits>
+#include <utility>
 
 namespace dev
 {
@@ -156,6 +157,15 @@ VariableDeclaration const* expr_to_decl(Expression const& _expr);
 
 // -------------------------------------------------------------------------- //
 
+/**
+ * Returns the source file and line (starting from 1) on which _node begins. If
+ * the file exists on disk, then its absolute path is used. If the location of
+ * _node is unknown, then the line is 0.
+ */
+std::pair<std::string, size_t> source_line(ASTNode const& _node);
+
+// -------------------------------------------------------------------------- //
+
 }
 }
 }
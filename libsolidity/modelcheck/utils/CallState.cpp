@@ -28,6 +28,10 @@ IntegerType const CallStateUtilities::COUNTABLE_TYPE(256);
 
 BoolType const CallStateUtilities::BOOLEAN_TYPE;
 
+string const CallStateUtilities::ENV_STRUCT = "sol_env";
+
+string const CallStateUtilities::ENV_PARAM = "env";
+
 // -------------------------------------------------------------------------- //
 
 CallStateUtilities::Field CallStateUtilities::parse_magic_type(
@@ -95,6 +99,19 @@ bool CallStateUtilities::is_contract_only(CallStateUtilities::Field _field)
 
 // -------------------------------------------------------------------------- //
 
+bool CallStateUtilities::is_env_field(CallStateUtilities::Field _field)
+{
+    switch (_field)
+    {
+    case CallStateUtilities::Field::Block: return true;
+    case CallStateUtilities::Field::Timestamp: return true;
+    case CallStateUtilities::Field::Origin: return true;
+    default: return false;
+    };
+}
+
+// -------------------------------------------------------------------------- //
+
 }
 }
 }
@@ -42,6 +42,15 @@ public:
     // Returns true if the field is specifically for contracts (not libraries).
     static bool is_contract_only(Field _field);
 
+    // Returns true if the field is fixed for the duration of a transaction. In
+    // this case, the field may be shared between all calls of a transaction.
+    static bool is_env_field(Field _field);
+
+    // The name of the structure which holds all transaction-level fields, and
+    // the name of the pointer through which it is passed.
+    static std::string const ENV_STRUCT;
+    static std::string const ENV_PARAM;
+
 private:
     // Static mapping from magic types to field names.
     static std::map<std::pair<MagicType::Kind, std::string>, Field> const
@@ -1,6 +1,8 @@
 #include <libsolidity/modelcheck/utils/Contract.h>
 
+#include <libsolidity/modelcheck/analysis/AnalysisStack.h>
 #include <libsolidity/modelcheck/analysis/VariableScope.h>
+#include <libsolidity/modelcheck/utils/Types.h>
 #include <stdexcept>
 
 using namespace std;
@@ -56,6 +58,39 @@ FunctionDefinition const& ContractUtilities::fallback(
 
 // -------------------------------------------------------------------------- //
 
+string ContractUtilities::global_name(VariableDeclaration const& _decl)
+{
+    auto const* SCOPE = dynamic_cast<ContractDefinition const*>(_decl.scope());
+    if (!SCOPE)
+    {
+        throw runtime_error("Global name requested for non-state variable.");
+    }
+
+    auto const NAME = VariableScopeResolver::rewrite(
+        _decl.name(), false, VarContext::STRUCT
+    );
+    return "g_" + escape_decl_name(*SCOPE) + "_" + NAME;
+}
+
+CExprPtr ContractUtilities::state_member(
+    AnalysisStack const& _stack,
+    CExprPtr _self,
+    VariableDeclaration const& _decl
+)
+{
+    if (_stack.hoists(_decl))
+    {
+        return make_shared<CIdentifier>(global_name(_decl), false);
+    }
+
+    auto const NAME = VariableScopeResolver::rewrite(
+        _decl.name(), false, VarContext::STRUCT
+    );
+    return make_shared<CMemberAccess>(move(_self), NAME);
+}
+
+// -------------------------------------------------------------------------- //
+
 }
 }
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/modelcheck/codegen/Details.h>
 
 #include <string>
 
@@ -18,6 +19,8 @@ namespace solidity
 namespace modelcheck
 {
 
+class AnalysisStack;
+
 // -------------------------------------------------------------------------- //
 
 /**
@@ -43,6 +46,17 @@ public:
     // to have a fallback function.
     static FunctionDefinition const& fallback(ContractDefinition const& _c);
 
+    // Returns the name of the global which holds _decl, if it is hoisted.
+    static std::string global_name(VariableDeclaration const& _decl);
+
+    // Returns an expression for state variable _decl of contract _self. If
+    // _stack hoists _decl, then this is its global.
+    static CExprPtr state_member(
+        AnalysisStack const& _stack,
+        CExprPtr _self,
+        VariableDeclaration const& _decl
+    );
+
 private:
     static AddressType const ADDRESS_MEMBER_TYPE;
     static IntegerType const BALANCE_MEMBER_TYPE;
@@ -77,13 +77,46 @@ CExprPtr LibVerify::byte(size_t _loc, string const& _msg)
     return builder.merge_and_pop();
 }
 
-void LibVerify::log(CBlockList & _block, string _msg)
+void LibVerify::log(CBlockList & _block, LogLevel _level, string _msg)
 {
-    CArgList arglist{ make_shared<CStringLiteral>(_msg) };
-    auto fn = make_shared<CFuncCall>("smartace_log", move(arglist));
+    CArgList arglist{
+        make_shared<CIntLiteral>(static_cast<long long int>(_level)),
+        make_shared<CStringLiteral>(_msg)
+    };
+    auto fn = make_shared<CFuncCall>("SOL_LOG", move(arglist));
     _block.push_back(fn->stmt());
 }
 
+CExprPtr LibVerify::addmod(CExprPtr _x, CExprPtr _y, CExprPtr _m)
+{
+    CArgList arglist{ move(_x), move(_y), move(_m) };
+    return make_shared<CFuncCall>("sol_addmod_uint256", move(arglist));
+}
+
+CExprPtr LibVerify::mulmod(CExprPtr _x, CExprPtr _y, CExprPtr _m)
+{
+    CArgList arglist{ move(_x), move(_y), move(_m) };
+    return make_shared<CFuncCall>("sol_mulmod_uint256", move(arglist));
+}
+
+CExprPtr LibVerify::hash_push(CExprPtr _prefix, CExprPtr _word, size_t _bytes)
+{
+    if (!_prefix) _prefix = make_shared<CIdentifier>("SOL_HASH_EMPTY", false);
+    CArgList arglist{
+        move(_prefix), move(_word), make_shared<CIntLiteral>(_bytes)
+    };
+    return make_shared<CFuncCall>("sol_hash_push", move(arglist));
+}
+
+CExprPtr LibVerify::hash_final(string const& _fn, CExprPtr _prefix)
+{
+    if (!_prefix) _prefix = make_shared<CIdentifier>("SOL_HASH_EMPTY", false);
+    CArgList arglist{
+        make_shared<CIdentifier>("SOL_HASH_" + _fn, false), move(_prefix)
+    };
+    return make_shared<CFuncCall>("sol_hash_final", move(arglist));
+}
+
 CExprPtr LibVerify::increase(
     size_t _loc, CExprPtr _curr, bool _strict, string _msg
 )
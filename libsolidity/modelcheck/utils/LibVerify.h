@@ -27,6 +27,11 @@ namespace modelcheck
 class LibVerify
 {
 public:
+    // The level of each log statement, as compared against MC_LOG_LEVEL.
+    // PHASE: logs at each stage of the model (setup, transaction loop, etc).
+    // CALL: logs at each call within the transaction loop.
+    enum class LogLevel { PHASE = 1, CALL = 2 };
+
     // The type of ND_GET_BYTE and ND_GET_RANGE.
     static IntegerType BYTE_TYPE;
 
@@ -55,8 +60,21 @@ public:
     // Generates a random byte of data, through a unique uninterpreted function.
     static CExprPtr byte(size_t _loc, std::string const& _msg);
 
-    // Appends a log statement to _block, with message _msg.
-    static void log(CBlockList & _block, std::string _msg);
+    // Appends `SOL_LOG(<_level>, <_msg>)` to _block.
+    static void log(CBlockList & _block, LogLevel _level, std::string _msg);
+
+    // Generates a call to `sol_addmod_uint256(<_x>, <_y>, <_m>)`.
+    static CExprPtr addmod(CExprPtr _x, CExprPtr _y, CExprPtr _m);
+
+    // Generates a call to `sol_mulmod_uint256(<_x>, <_y>, <_m>)`.
+    static CExprPtr mulmod(CExprPtr _x, CExprPtr _y, CExprPtr _m);
+
+    // Generates a call to `sol_hash_push(<_prefix>, <_word>, <_bytes>)`. If
+    // _prefix is null, then the word is pushed to SOL_HASH_EMPTY.
+    static CExprPtr hash_push(CExprPtr _prefix, CExprPtr _word, size_t _bytes);
+
+    // Generates a call to `sol_hash_final(SOL_HASH_<_fn>, <_prefix>)`.
+    static CExprPtr hash_final(std::string const& _fn, CExprPtr _prefix);
 
     // Appends a log statement to _block, with message _msg.
     static CExprPtr increase(
@@ -15,7 +15,7 @@ namespace modelcheck
 
 Named::Named(Declaration const& _decl) : M_NAME(_decl.name()) {}
 
-string Named::name() const { return M_NAME; }
+string const& Named::name() const { return M_NAME; }
 
 // -------------------------------------------------------------------------- //
 
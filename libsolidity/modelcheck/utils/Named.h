@@ -35,7 +35,7 @@ public:
     explicit Named(Declaration const& _decl);
 
     // Returns the name of this entity.
-    std::string name() const;
+    std::string const& name() const;
 
 private:
     std::string const M_NAME;
@@ -0,0 +1,161 @@
+/**
+ * Side tables for analysis results. Solidity numbers each AST node through a
+ * counter which is reset once per compilation, so the IDs of a single model are
+ * dense. These tables are indexed by said IDs, rather than by node address, so
+ * that each lookup is a single vector access. Generated C names are interned,
+ * so that each distinct name is stored once.
+ *
+ * @date 2020
+ */
+
+#pragma once
+
+#include <libsolidity/ast/AST.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+
+// -------------------------------------------------------------------------- //
+
+/**
+ * Associates values of type T with AST nodes from a single compilation. Entries
+ * are iterated in order of node ID, which is also declaration order.
+ */
+template <typename T>
+class NodeTable
+{
+public:
+    // Returns the entry for _node, or nullptr if it has no entry.
+    T const* find(ASTNode const& _node) const
+    {
+        size_t const ID = _node.id();
+        if (ID >= m_keys.size() || m_keys[ID] != &_node) return nullptr;
+        return &m_vals[ID];
+    }
+
+    T* find(ASTNode const& _node)
+    {
+        auto const& SELF = *this;
+        return const_cast<T*>(SELF.find(_node));
+    }
+
+    // Returns true if _node has an entry.
+    bool contains(ASTNode const& _node) const { return find(_node) != nullptr; }
+
+    // Sets the entry for _node to _val, unless it already has an entry. Returns
+    // true if the entry was set.
+    bool insert(ASTNode const& _node, T _val)
+    {
+        if (contains(_node)) return false;
+        (*this)[_node] = std::move(_val);
+        return true;
+    }
+
+    // Returns the entry for _node, default-constructing it if needed. Throws if
+    // _node shares its ID with a node from another compilation.
+    T& operator[](ASTNode const& _node)
+    {
+        size_t const ID = _node.id();
+        if (ID >= m_keys.size())
+        {
+            m_keys.resize(ID + 1, nullptr);
+            m_vals.resize(ID + 1);
+        }
+
+        if (m_keys[ID] == nullptr)
+        {
+            m_keys[ID] = &_node;
+            ++m_size;
+        }
+        else if (m_keys[ID] != &_node)
+        {
+            throw std::runtime_error("NodeTable spans several compilations.");
+        }
+        return m_vals[ID];
+    }
+
+    // Returns the number of entries.
+    size_t size() const { return m_size; }
+
+    // Applies _f to each (node, value) pair, in order of node ID.
+    template <typename F>
+    void for_each(F _f) const
+    {
+        for (size_t i = 0; i < m_keys.size(); ++i)
+        {
+            if (m_keys[i]) _f(*m_keys[i], m_vals[i]);
+        }
+    }
+
+private:
+    std::vector<ASTNode const*> m_keys;
+    std::vector<T> m_vals;
+    size_t m_size = 0;
+};
+
+// -------------------------------------------------------------------------- //
+
+/**
+ * Interns strings. Each distinct string is given a dense ID, and is stored once
+ * for the lifetime of the table.
+ */
+class NameTable
+{
+public:
+    using Id = uint32_t;
+
+    NameTable() = default;
+    NameTable(NameTable&&) = default;
+    NameTable& operator=(NameTable&&) = default;
+
+    // Copies must refer to their own strings.
+    NameTable(NameTable const& _other): m_ids(_other.m_ids) { reindex(); }
+    NameTable& operator=(NameTable const& _other)
+    {
+        m_ids = _other.m_ids;
+        reindex();
+        return *this;
+    }
+
+    // Returns the ID of _name, recording it if it is new.
+    Id intern(std::string const& _name)
+    {
+        auto const RES = m_ids.emplace(_name, static_cast<Id>(m_names.size()));
+        if (RES.second) m_names.push_back(&RES.first->first);
+        return RES.first->second;
+    }
+
+    // Returns the string with ID _id.
+    std::string const& at(Id _id) const { return *m_names.at(_id); }
+
+    // Returns the number of distinct strings.
+    size_t size() const { return m_names.size(); }
+
+private:
+    // Keys of an unordered_map are stable across rehashing.
+    std::unordered_map<std::string, Id> m_ids;
+    std::vector<std::string const*> m_names;
+
+    // Rebuilds m_names from m_ids.
+    void reindex()
+    {
+        m_names.assign(m_ids.size(), nullptr);
+        for (auto const& entry : m_ids) m_names[entry.second] = &entry.first;
+    }
+};
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
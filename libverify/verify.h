@@ -162,9 +162,37 @@ typedef uint64_t sol_raw_uint256_t;
 extern "C" {
 #endif
 
-// Overapproximation of keccak256.
+// Overapproximation of keccak256. This is used when the input to a hash cannot
+// be expressed as a sequence of words (see sol_hash_push).
 sol_raw_uint8_t sol_crypto(void);
 
+// Models keccak256, sha256, ripemd160 and ecrecover as memoized uninterpreted
+// functions. The input to a hash is folded into a prefix, one word at a time,
+// starting from SOL_HASH_EMPTY. Each word is encoded in _bytes bytes, as in
+// abi.encodePacked. The digest of a prefix under function _fn is then given by
+// sol_hash_final. Within a trace, equal inputs always produce equal outputs.
+#define SOL_HASH_EMPTY 0
+#define SOL_HASH_KECCAK256 1
+#define SOL_HASH_SHA256 2
+#define SOL_HASH_RIPEMD160 3
+#define SOL_HASH_ECRECOVER 4
+sol_raw_uint256_t sol_hash_push(
+    sol_raw_uint256_t _prefix, sol_raw_uint256_t _word, uint8_t _bytes
+);
+sol_raw_uint256_t sol_hash_final(uint8_t _fn, sol_raw_uint256_t _prefix);
+
+// Storage for the global variables of the c-model. The explicit-state and
+// random-walk runtimes execute the model on many threads, so each thread is
+// given its own copy.
+#if defined(MC_EXPLICIT_STATE) || defined(MC_RANDOM_WALK)
+#define SOL_GLOBAL thread_local
+#else
+#define SOL_GLOBAL
+#endif
+
+// Marks functions which must be inlined, even if optimizations are disabled.
+#define SOL_ALWAYS_INLINE static inline __attribute__((always_inline))
+
 // Forward declares the entry-point to the c-model.
 void run_model(void);
 
@@ -183,6 +211,83 @@ uint8_t sol_continue(void);
 // This method is called once before each transaction.
 void sol_on_transaction(void);
 
+// The model generates sol_state_hash, which folds all state carried between
+// transactions (the block number and timestamp, literal addresses, and the
+// balances, scalars and map entries of each actor) into a single word through
+// sol_state_mix. It also generates sol_coverage_hash, which folds only the
+// balances, scalars and map entries of each actor. If MC_STATE_HASH is defined,
+// then a hash is reported to sol_on_state after each transaction. This is
+// implemented by the libFuzzer runtime, where each novel coverage hash is
+// treated as new coverage, and by the explicit-state runtime, which receives
+// the full state hash. Otherwise, neither hash is computed.
+void sol_on_state(uint64_t _hash);
+#if defined(MC_STATE_HASH) && defined(MC_EXPLICIT_STATE)
+#define SOL_ON_STATE(__state, __coverage) sol_on_state(__state)
+#elif defined(MC_STATE_HASH)
+#define SOL_ON_STATE(__state, __coverage) sol_on_state(__coverage)
+#else
+#define SOL_ON_STATE(__state, __coverage) ((void)0)
+#endif
+
+static inline uint64_t sol_state_mix(uint64_t _hash, sol_raw_uint256_t _word)
+{
+#ifdef MC_USE_BOOST_MP
+    for (int i = 0; i < 4; ++i)
+    {
+        uint64_t limb = (_word & UINT64_MAX).convert_to<uint64_t>();
+        _hash ^= limb + 0x9e3779b97f4a7c15ULL + (_hash << 6) + (_hash >> 2);
+        _word >>= 64;
+    }
+#else
+    uint64_t limb = (uint64_t)(_word);
+    _hash ^= limb + 0x9e3779b97f4a7c15ULL + (_hash << 6) + (_hash >> 2);
+#endif
+    return _hash;
+}
+
+// The model generates sol_state_observe, which reports each unsigned word of
+// actor state through SOL_OBSERVE. Each word is labeled by the C expression
+// which reads it, and by its kind. Entries and sums of the same map share a
+// group. If MC_MINE_INVARIANTS is defined, then a snapshot is reported after
+// setup and after each transaction. This is implemented by the miner runtime,
+// which writes candidate invariants to invariants.h.
+#define SOL_OBSERVE_SCALAR 0
+#define SOL_OBSERVE_ENTRY 1
+#define SOL_OBSERVE_SUM 2
+#ifdef MC_MINE_INVARIANTS
+void sol_snapshot_begin(void);
+void sol_observe(
+    const char* _expr, uint8_t _kind, uint32_t _group, sol_raw_uint256_t _val
+);
+void sol_snapshot_end(void);
+#define SOL_OBSERVE(__expr, __kind, __group, __val) \
+    sol_observe(__expr, __kind, __group, __val)
+#define SOL_ON_SNAPSHOT(__call) \
+    (sol_snapshot_begin(), (__call), sol_snapshot_end())
+#else
+#define SOL_OBSERVE(__expr, __kind, __group, __val) ((void)0)
+#define SOL_ON_SNAPSHOT(__call) ((void)0)
+#endif
+
+// If MC_USE_INVARIANTS is defined, then the lemmas of invariants.h (given as
+// SOL_LEMMAS) are assumed before each transaction, and are checked after setup
+// and after each transaction. As each lemma is checked, a lemma which does not
+// hold is reported as a failed assertion rather than trusted. Likewise, if
+// MC_USE_SEA_LEMMAS is defined, then the lemmas of sea_lemmas.h (given as
+// SOL_SEA_LEMMAS) are assumed and checked. These are translated by make verify
+// from the invariants of its last safe run.
+#if defined(MC_USE_INVARIANTS) || defined(MC_USE_SEA_LEMMAS)
+#define SOL_ON_LEMMAS(__call) __call
+#else
+#define SOL_ON_LEMMAS(__call) ((void)0)
+#endif
+#ifndef MC_USE_INVARIANTS
+#define SOL_LEMMAS 1
+#endif
+#ifndef MC_USE_SEA_LEMMAS
+#define SOL_SEA_LEMMAS 1
+#endif
+
 // Placeholder calls for require() and assert() in solidity.
 void sol_require(sol_raw_uint8_t _cond, const char* _msg);
 void sol_assert(sol_raw_uint8_t cond, const char* _msg);
@@ -196,6 +301,34 @@ void ll_assume(sol_raw_uint8_t _cond);
 // Allows logs from the model.
 void smartace_log(const char* _msg);
 
+// Logging is filtered at compile-time by MC_LOG_LEVEL. The model emits logs
+// through SOL_LOG(level, msg), where level is a literal from 1 to 3.
+// 1: logs each phase of the model (setup, the transaction loop, etc).
+// 2: logs each call within the transaction loop.
+// 3: also forwards a description of each nondeterministic value.
+// Logs above MC_LOG_LEVEL are removed by the preprocessor, along with their
+// string literals. If MC_LOG_LEVEL is undefined, then all logs are kept.
+#ifndef MC_LOG_LEVEL
+#define MC_LOG_LEVEL 3
+#endif
+
+#define SOL_LOG(__lvl, __msg) SOL_LOG_ ## __lvl (__msg)
+#if MC_LOG_LEVEL >= 1
+#define SOL_LOG_1(__msg) smartace_log(__msg)
+#else
+#define SOL_LOG_1(__msg) ((void)0)
+#endif
+#if MC_LOG_LEVEL >= 2
+#define SOL_LOG_2(__msg) smartace_log(__msg)
+#else
+#define SOL_LOG_2(__msg) ((void)0)
+#endif
+#if MC_LOG_LEVEL >= 3
+#define SOL_ND_MSG(__msg) (__msg)
+#else
+#define SOL_ND_MSG(__msg) ((const char*)0)
+#endif
+
 // Macros for generating location-specifc non-deterministic sources. The __loc
 // values are used to distinguish sources. All other arguments are forwarded to
 // the underlying method.
@@ -203,26 +336,26 @@ void smartace_log(const char* _msg);
 #define GET_SEA_ND_HOOK(__loc) \
     (sea_nd_ ## __loc ())
 #define GET_ND_BYTE(__loc, __msg) \
-    nd_byte(GET_SEA_ND_HOOK(__loc), (__msg))
+    nd_byte(GET_SEA_ND_HOOK(__loc), SOL_ND_MSG(__msg))
 #define GET_ND_RANGE(__loc, __lo, __hi, __msg) \
-    nd_range(GET_SEA_ND_HOOK(__loc), (__lo), (__hi), (__msg))
+    nd_range(GET_SEA_ND_HOOK(__loc), (__lo), (__hi), SOL_ND_MSG(__msg))
 #define GET_ND_INCREASE(__loc, __curr, __strict, __msg) \
-    nd_increase(GET_SEA_ND_HOOK(__loc), (__curr), (__strict), (__msg))
+    nd_increase(GET_SEA_ND_HOOK(__loc), (__curr), (__strict), SOL_ND_MSG(__msg))
 #define GET_ND_INT(__loc, __width, __msg) \
-    (nd_int ## __width ## _t(GET_SEA_ND_HOOK(__loc), (__msg)))
+    (nd_int ## __width ## _t(GET_SEA_ND_HOOK(__loc), SOL_ND_MSG(__msg)))
 #define GET_ND_UINT(__loc, __width, __msg) \
-    (nd_uint ## __width ## _t(GET_SEA_ND_HOOK(__loc), (__msg)))
+    (nd_uint ## __width ## _t(GET_SEA_ND_HOOK(__loc), SOL_ND_MSG(__msg)))
 #else
 #define GET_ND_BYTE(__loc, __msg) \
-    nd_byte(0, (__msg))
+    nd_byte(0, SOL_ND_MSG(__msg))
 #define GET_ND_RANGE(__loc, __lo, __hi, __msg) \
-    nd_range(0, (__lo), (__hi), (__msg))
+    nd_range(0, (__lo), (__hi), SOL_ND_MSG(__msg))
 #define GET_ND_INCREASE(__loc, __curr, __strict, __msg) \
-    nd_increase(0, (__curr), (__strict), (__msg))
+    nd_increase(0, (__curr), (__strict), SOL_ND_MSG(__msg))
 #define GET_ND_INT(__loc, __width, __msg) \
-    (nd_int ## __width ## _t(0, (__msg)))
+    (nd_int ## __width ## _t(0, SOL_ND_MSG(__msg)))
 #define GET_ND_UINT(__loc, __width, __msg) \
-    (nd_uint ## __width ## _t(0, (__msg)))
+    (nd_uint ## __width ## _t(0, SOL_ND_MSG(__msg)))
 #endif
 
 // Returns a raw byte without any wrapping. This is meant to be used by the
@@ -312,3 +445,217 @@ sol_raw_uint256_t nd_uint256_t(sol_raw_int256_t _sea_hint, const char* _msg);
 #ifdef __cplusplus
 }
 #endif
+
+// Overflow-checked arithmetic. For each Solidity integer type (u)intN, this
+// provides sol_add_(u)intN, sol_sub_(u)intN and sol_mul_(u)intN. Each helper
+// returns the result of the operation, and fails an assertion if the result
+// does not fit in the Solidity type. In the STDINT model, types wider than 64
+// bits are checked against their 64-bit representation. The helpers are only
+// defined if the model was generated with overflow checks, in which case the
+// generator defines MC_OVERFLOW_CHECKS.
+#ifdef MC_USE_STDINT
+#define SOL_UINT_MAX(__bits) \
+    ((__bits) >= 64 ? UINT64_MAX : (((uint64_t)1 << ((__bits) % 64)) - 1))
+#define SOL_INT_MAX(__bits) \
+    ((__bits) >= 64 \
+        ? INT64_MAX : (int64_t)(((uint64_t)1 << (((__bits) - 1) % 64)) - 1))
+#endif
+
+#ifdef MC_OVERFLOW_CHECKS
+#ifdef MC_USE_BOOST_MP
+static inline uint8_t sol_in_range(
+    boost::multiprecision::cpp_int const& _v, unsigned _bits, uint8_t _signed
+)
+{
+    boost::multiprecision::cpp_int const ONE(1);
+    if (_signed)
+    {
+        return (_v >= -(ONE << (_bits - 1))) && (_v < (ONE << (_bits - 1)));
+    }
+    return (_v >= 0) && (_v < (ONE << _bits));
+}
+#define SOL_IN_RANGE_int(__v, __bits) sol_in_range((__v), (__bits), 1)
+#define SOL_IN_RANGE_uint(__v, __bits) sol_in_range((__v), (__bits), 0)
+#define SOL_CHECKED_OP(__name, __op, __sym, __bits) \
+    static inline sol_raw_ ## __sym ## __bits ## _t \
+    sol_ ## __name ## _ ## __sym ## __bits( \
+        sol_raw_ ## __sym ## __bits ## _t _a, \
+        sol_raw_ ## __sym ## __bits ## _t _b) \
+    { \
+        boost::multiprecision::cpp_int const RES \
+            = boost::multiprecision::cpp_int(_a) \
+            __op boost::multiprecision::cpp_int(_b); \
+        sol_assert(SOL_IN_RANGE_ ## __sym(RES, __bits), "Integer overflow."); \
+        return sol_raw_ ## __sym ## __bits ## _t(RES); \
+    }
+#define SOL_EXACT_CHECKED_OP SOL_CHECKED_OP
+#elif defined MC_USE_STDINT
+#define SOL_IN_RANGE_int(__v, __bits) \
+    (((int64_t)(__v) >= -SOL_INT_MAX(__bits) - 1) \
+        && ((int64_t)(__v) <= SOL_INT_MAX(__bits)))
+#define SOL_IN_RANGE_uint(__v, __bits) \
+    ((uint64_t)(__v) <= SOL_UINT_MAX(__bits))
+#define SOL_CHECKED_OP(__name, __op, __sym, __bits) \
+    static inline sol_raw_ ## __sym ## __bits ## _t \
+    sol_ ## __name ## _ ## __sym ## __bits( \
+        sol_raw_ ## __sym ## __bits ## _t _a, \
+        sol_raw_ ## __sym ## __bits ## _t _b) \
+    { \
+        sol_raw_ ## __sym ## __bits ## _t res; \
+        uint8_t ovf = __builtin_ ## __name ## _overflow(_a, _b, &res); \
+        sol_assert( \
+            !ovf && SOL_IN_RANGE_ ## __sym(res, __bits), "Integer overflow." \
+        ); \
+        return res; \
+    }
+// If the raw type has exactly the width of the Solidity type (or is the 64-bit
+// representation of a wider type), the builtin alone decides overflow.
+#define SOL_EXACT_CHECKED_OP(__name, __op, __sym, __bits) \
+    static inline sol_raw_ ## __sym ## __bits ## _t \
+    sol_ ## __name ## _ ## __sym ## __bits( \
+        sol_raw_ ## __sym ## __bits ## _t _a, \
+        sol_raw_ ## __sym ## __bits ## _t _b) \
+    { \
+        sol_raw_ ## __sym ## __bits ## _t res; \
+        uint8_t ovf = __builtin_ ## __name ## _overflow(_a, _b, &res); \
+        sol_assert(!ovf, "Integer overflow."); \
+        return res; \
+    }
+#endif
+
+#define SOL_CHECKED_OPS(__sym, __bits) \
+    SOL_CHECKED_OP(add, +, __sym, __bits) \
+    SOL_CHECKED_OP(sub, -, __sym, __bits) \
+    SOL_CHECKED_OP(mul, *, __sym, __bits)
+#define SOL_EXACT_CHECKED_OPS(__sym, __bits) \
+    SOL_EXACT_CHECKED_OP(add, +, __sym, __bits) \
+    SOL_EXACT_CHECKED_OP(sub, -, __sym, __bits) \
+    SOL_EXACT_CHECKED_OP(mul, *, __sym, __bits)
+
+SOL_EXACT_CHECKED_OPS(int, 8)
+SOL_EXACT_CHECKED_OPS(uint, 8)
+SOL_EXACT_CHECKED_OPS(int, 16)
+SOL_EXACT_CHECKED_OPS(uint, 16)
+SOL_CHECKED_OPS(int, 24)
+SOL_CHECKED_OPS(uint, 24)
+SOL_EXACT_CHECKED_OPS(int, 32)
+SOL_EXACT_CHECKED_OPS(uint, 32)
+SOL_CHECKED_OPS(int, 40)
+SOL_CHECKED_OPS(uint, 40)
+SOL_CHECKED_OPS(int, 48)
+SOL_CHECKED_OPS(uint, 48)
+SOL_CHECKED_OPS(int, 56)
+SOL_CHECKED_OPS(uint, 56)
+SOL_EXACT_CHECKED_OPS(int, 64)
+SOL_EXACT_CHECKED_OPS(uint, 64)
+SOL_EXACT_CHECKED_OPS(int, 72)
+SOL_EXACT_CHECKED_OPS(uint, 72)
+SOL_EXACT_CHECKED_OPS(int, 80)
+SOL_EXACT_CHECKED_OPS(uint, 80)
+SOL_EXACT_CHECKED_OPS(int, 88)
+SOL_EXACT_CHECKED_OPS(uint, 88)
+SOL_EXACT_CHECKED_OPS(int, 96)
+SOL_EXACT_CHECKED_OPS(uint, 96)
+SOL_EXACT_CHECKED_OPS(int, 104)
+SOL_EXACT_CHECKED_OPS(uint, 104)
+SOL_EXACT_CHECKED_OPS(int, 112)
+SOL_EXACT_CHECKED_OPS(uint, 112)
+SOL_EXACT_CHECKED_OPS(int, 120)
+SOL_EXACT_CHECKED_OPS(uint, 120)
+SOL_EXACT_CHECKED_OPS(int, 128)
+SOL_EXACT_CHECKED_OPS(uint, 128)
+SOL_EXACT_CHECKED_OPS(int, 136)
+SOL_EXACT_CHECKED_OPS(uint, 136)
+SOL_EXACT_CHECKED_OPS(int, 144)
+SOL_EXACT_CHECKED_OPS(uint, 144)
+SOL_EXACT_CHECKED_OPS(int, 152)
+SOL_EXACT_CHECKED_OPS(uint, 152)
+SOL_EXACT_CHECKED_OPS(int, 160)
+SOL_EXACT_CHECKED_OPS(uint, 160)
+SOL_EXACT_CHECKED_OPS(int, 168)
+SOL_EXACT_CHECKED_OPS(uint, 168)
+SOL_EXACT_CHECKED_OPS(int, 176)
+SOL_EXACT_CHECKED_OPS(uint, 176)
+SOL_EXACT_CHECKED_OPS(int, 184)
+SOL_EXACT_CHECKED_OPS(uint, 184)
+SOL_EXACT_CHECKED_OPS(int, 192)
+SOL_EXACT_CHECKED_OPS(uint, 192)
+SOL_EXACT_CHECKED_OPS(int, 200)
+SOL_EXACT_CHECKED_OPS(uint, 200)
+SOL_EXACT_CHECKED_OPS(int, 208)
+SOL_EXACT_CHECKED_OPS(uint, 208)
+SOL_EXACT_CHECKED_OPS(int, 216)
+SOL_EXACT_CHECKED_OPS(uint, 216)
+SOL_EXACT_CHECKED_OPS(int, 224)
+SOL_EXACT_CHECKED_OPS(uint, 224)
+SOL_EXACT_CHECKED_OPS(int, 232)
+SOL_EXACT_CHECKED_OPS(uint, 232)
+SOL_EXACT_CHECKED_OPS(int, 240)
+SOL_EXACT_CHECKED_OPS(uint, 240)
+SOL_EXACT_CHECKED_OPS(int, 248)
+SOL_EXACT_CHECKED_OPS(uint, 248)
+SOL_EXACT_CHECKED_OPS(int, 256)
+SOL_EXACT_CHECKED_OPS(uint, 256)
+#endif
+
+// Modular arithmetic as in addmod and mulmod. The intermediate sum or product
+// is computed exactly, rather than modulo the width of the integer type. As in
+// Solidity, a modulus of zero fails an assertion.
+#ifdef MC_USE_BOOST_MP
+static inline sol_raw_uint256_t sol_addmod_uint256(
+    sol_raw_uint256_t _x, sol_raw_uint256_t _y, sol_raw_uint256_t _m
+)
+{
+    sol_assert(_m != 0, "Modulus of zero in addmod.");
+    if (_m == 0) return 0;
+    boost::multiprecision::uint512_t const SUM
+        = boost::multiprecision::uint512_t(_x)
+        + boost::multiprecision::uint512_t(_y);
+    return sol_raw_uint256_t(SUM % boost::multiprecision::uint512_t(_m));
+}
+
+static inline sol_raw_uint256_t sol_mulmod_uint256(
+    sol_raw_uint256_t _x, sol_raw_uint256_t _y, sol_raw_uint256_t _m
+)
+{
+    sol_assert(_m != 0, "Modulus of zero in mulmod.");
+    if (_m == 0) return 0;
+    boost::multiprecision::uint512_t const PROD
+        = boost::multiprecision::uint512_t(_x)
+        * boost::multiprecision::uint512_t(_y);
+    return sol_raw_uint256_t(PROD % boost::multiprecision::uint512_t(_m));
+}
+#elif defined MC_USE_STDINT
+static inline sol_raw_uint256_t sol_addmod_uint256(
+    sol_raw_uint256_t _x, sol_raw_uint256_t _y, sol_raw_uint256_t _m
+)
+{
+    sol_assert(_m != 0, "Modulus of zero in addmod.");
+    if (_m == 0) return 0;
+    sol_raw_uint256_t const X = _x % _m;
+    sol_raw_uint256_t const Y = _y % _m;
+    return (X >= _m - Y) ? (X - (_m - Y)) : (X + Y);
+}
+
+static inline sol_raw_uint256_t sol_mulmod_uint256(
+    sol_raw_uint256_t _x, sol_raw_uint256_t _y, sol_raw_uint256_t _m
+)
+{
+    sol_assert(_m != 0, "Modulus of zero in mulmod.");
+    if (_m == 0) return 0;
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 const PROD = (unsigned __int128)_x * _y;
+    return (sol_raw_uint256_t)(PROD % _m);
+#else
+    // Double-and-add, without leaving the range [0, _m).
+    sol_raw_uint256_t res = 0;
+    sol_raw_uint256_t base = _x % _m;
+    for (; _y != 0; _y >>= 1)
+    {
+        if (_y & 1) res = sol_addmod_uint256(res, base, _m);
+        base = sol_addmod_uint256(base, base, _m);
+    }
+    return res;
+#endif
+}
+#endif
@@ -0,0 +1,605 @@
+/**
+ * Defines an explicit-state runtime for the c-model. Each nondeterministic value
+ * is drawn from a small, finite domain, and the model is searched transaction by
+ * transaction. Rather than saving and restoring the model state, a state is
+ * restored by replaying the choices which led to it, from the initial state.
+ * States are identified by sol_state_hash, which covers all state carried
+ * between transactions, and each state is expanded at most once. The search is
+ * split across threads, which steal work from each other.
+ *
+ * If an assertion fails, then the choices are written out as a trace which may
+ * be replayed (or minimized) by icmodel.
+ *
+ * @date 2020
+ */
+
+#include "verify.h"
+#include "verify_hash_concrete.h"
+
+#ifndef MC_USE_STDINT
+#error The explicit-state runtime requires MC_USE_STDINT.
+#endif
+
+#ifndef MC_STATE_HASH
+#error The explicit-state runtime requires MC_STATE_HASH.
+#endif
+
+#include <boost/program_options.hpp>
+
+#include <atomic>
+#include <csetjmp>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace po = boost::program_options;
+
+// -------------------------------------------------------------------------- //
+
+// A nondeterministic value, given as an index into its domain of values.
+struct SolChoice
+{
+    uint32_t index;
+    uint32_t domain;
+};
+
+// A state to expand. The state is reached by taking the choices in path, and
+// is reached after depth transactions.
+struct SolJob
+{
+    vector<uint32_t> path;
+    uint32_t depth;
+};
+
+// The ways in which a single execution of the model may end.
+// STATE: the target transaction completed.
+// REQUIRE_FAILED: the execution was infeasible.
+// ASSERT_FAILED: the execution violated an assertion.
+enum class SolOutcome { STATE = 1, REQUIRE_FAILED, ASSERT_FAILED };
+
+// The context of a single execution of the model.
+struct SolRun
+{
+    // The choices to replay. Choices beyond the prefix take index 0.
+    vector<uint32_t> const* prefix;
+
+    // All choices taken so far.
+    vector<SolChoice> choices;
+
+    // The value of each choice, formatted as input to icmodel.
+    vector<string> tokens;
+
+    // The execution ends after target transactions.
+    uint32_t target;
+    uint32_t transactions;
+
+    // The hash of the state reached, and the reason for failure (if any).
+    uint64_t hash;
+    char const* msg;
+
+    jmp_buf env;
+};
+
+// -------------------------------------------------------------------------- //
+
+/**
+ * A lock-free set of state hashes, using open addressing. Zero marks an empty
+ * slot, so a hash of zero is stored as one. If a probe sequence is exhausted,
+ * then the hash is reported as new, and the state is expanded again.
+ */
+class SolVisitedSet
+{
+public:
+    explicit SolVisitedSet(unsigned _bits)
+        : M_MASK((uint64_t(1) << _bits) - 1)
+        , m_slots(new atomic<uint64_t>[M_MASK + 1]())
+    {
+    }
+
+    // Returns true if _hash was not yet in the set.
+    bool insert(uint64_t _hash)
+    {
+        uint64_t const HASH = (_hash == 0) ? 1 : _hash;
+        uint64_t slot = (HASH * 0x9e3779b97f4a7c15ULL) >> 16;
+        for (size_t i = 0; i < M_MAX_PROBES; ++i)
+        {
+            auto & entry = m_slots[(slot + i) & M_MASK];
+            uint64_t expected = 0;
+            if (entry.compare_exchange_strong(expected, HASH)) return true;
+            if (expected == HASH) return false;
+        }
+        m_overflow = true;
+        return true;
+    }
+
+    // Returns true if some hash could not be stored.
+    bool overflowed() const { return m_overflow; }
+
+private:
+    static constexpr size_t M_MAX_PROBES = 64;
+
+    uint64_t const M_MASK;
+    unique_ptr<atomic<uint64_t>[]> m_slots;
+    atomic<bool> m_overflow{false};
+};
+
+// -------------------------------------------------------------------------- //
+
+/**
+ * Distributes jobs between workers. Each worker owns a queue. A worker takes
+ * jobs from the back of its own queue in DFS mode, or from the front in BFS
+ * mode. If its queue is empty, then it steals from the front of another queue.
+ * The pool is drained once no jobs are queued and no jobs are in progress.
+ */
+class SolWorkPool
+{
+public:
+    SolWorkPool(size_t _workers, bool _dfs): M_DFS(_dfs)
+    {
+        for (size_t i = 0; i < _workers; ++i)
+        {
+            m_queues.emplace_back(new Queue);
+        }
+    }
+
+    // Adds _job to the queue of _worker.
+    void push(size_t _worker, SolJob _job)
+    {
+        ++m_pending;
+        auto & queue = *m_queues[_worker];
+        lock_guard<mutex> guard(queue.lock);
+        queue.jobs.push_back(move(_job));
+    }
+
+    // Sets _job to the next job for _worker. Returns false once the pool is
+    // drained, or stopped.
+    bool pop(size_t _worker, SolJob & _job)
+    {
+        while (!m_stop)
+        {
+            if (take(_worker, _job, M_DFS)) return true;
+            for (size_t i = 1; i < m_queues.size(); ++i)
+            {
+                size_t const VICTIM = (_worker + i) % m_queues.size();
+                if (take(VICTIM, _job, false)) return true;
+            }
+            if (m_pending == 0) return false;
+            this_thread::yield();
+        }
+        return false;
+    }
+
+    // Marks a job as complete. Any children must be pushed first.
+    void finish() { --m_pending; }
+
+    // Drains the pool early.
+    void stop() { m_stop = true; }
+
+private:
+    struct Queue
+    {
+        mutex lock;
+        deque<SolJob> jobs;
+    };
+
+    bool const M_DFS;
+    vector<unique_ptr<Queue>> m_queues;
+    atomic<size_t> m_pending{0};
+    atomic<bool> m_stop{false};
+
+    // Takes a job from queue _idx, from the back if _back is set.
+    bool take(size_t _idx, SolJob & _job, bool _back)
+    {
+        auto & queue = *m_queues[_idx];
+        lock_guard<mutex> guard(queue.lock);
+        if (queue.jobs.empty()) return false;
+        if (_back)
+        {
+            _job = move(queue.jobs.back());
+            queue.jobs.pop_back();
+        }
+        else
+        {
+            _job = move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------- //
+
+static const char g_solHelpCliArg[] = "help";
+static const char g_solHelpCliMsg[] = "display options and settings";
+static const char g_solThreadsCliArg[] = "threads";
+static const char g_solThreadsCliMsg[] = "number of worker threads";
+static const char g_solDepthCliArg[] = "depth";
+static const char g_solDepthCliMsg[] = "maximum number of transactions";
+static const char g_solValuesCliArg[] = "values";
+static const char g_solValuesCliMsg[] = "values tried for each integer input";
+static const char g_solDfsCliArg[] = "dfs";
+static const char g_solDfsCliMsg[] = "search depth-first, not breadth-first";
+static const char g_solTableCliArg[] = "table-bits";
+static const char g_solTableCliMsg[] = "log2 of the visited state table size";
+static const char g_solCexCliArg[] = "cex";
+static const char g_solCexCliMsg[] = "file to write a counterexample trace to";
+static const char g_solZRetCliArg[] = "return-0";
+static const char g_solZRetCliMsg[] = "when true, violations return 0";
+
+static unsigned g_solThreads;
+static uint32_t g_solDepth;
+static uint32_t g_solValues;
+static bool g_solDfs;
+static unsigned g_solTableBits;
+static string g_solCexPath;
+static bool g_solZRet;
+
+// Each worker executes the model through its own context.
+static thread_local SolRun* t_solRun;
+static thread_local SolHashModel t_solHashModel;
+
+static unique_ptr<SolVisitedSet> g_solVisited;
+static atomic<uint64_t> g_solRuns{0};
+static atomic<uint64_t> g_solStates{0};
+static atomic<bool> g_solFoundCex{false};
+static mutex g_solCexLock;
+
+// Ends the current execution with _outcome.
+static void sol_end_run(SolOutcome _outcome, char const* _msg)
+{
+    t_solRun->msg = _msg;
+    longjmp(t_solRun->env, static_cast<int>(_outcome));
+}
+
+// Takes the next choice, from a domain of _domain values.
+static uint32_t sol_choose(uint32_t _domain)
+{
+    auto & run = *t_solRun;
+    if (_domain == 0) sol_end_run(SolOutcome::REQUIRE_FAILED, nullptr);
+
+    size_t const IDX = run.choices.size();
+    uint32_t choice = 0;
+    if (IDX < run.prefix->size()) choice = (*run.prefix)[IDX];
+    run.choices.push_back({ choice, _domain });
+    return choice;
+}
+
+// Records _value as the input to icmodel for the latest choice.
+template <typename T>
+static T sol_record(T _value)
+{
+    t_solRun->tokens.push_back(to_string(_value));
+    return _value;
+}
+
+// Maps the choice 0, 1, 2, 3, 4, ... to 0, 1, -1, 2, -2, ...
+static int64_t sol_choose_signed(void)
+{
+    int64_t const CHOICE = sol_choose(g_solValues);
+    return (CHOICE % 2 == 1) ? (CHOICE + 1) / 2 : -(CHOICE / 2);
+}
+
+// Executes the model along _prefix, until _target transactions complete.
+static SolOutcome sol_execute(
+    vector<uint32_t> const& _prefix, uint32_t _target, SolRun & _run
+)
+{
+    _run.prefix = &_prefix;
+    _run.choices.clear();
+    _run.tokens.clear();
+    _run.target = _target;
+    _run.transactions = 0;
+    _run.msg = nullptr;
+
+    t_solRun = &_run;
+    t_solHashModel.reset();
+    ++g_solRuns;
+
+    int const CODE = setjmp(_run.env);
+    if (CODE == 0)
+    {
+        run_model();
+        return SolOutcome::REQUIRE_FAILED;
+    }
+    return static_cast<SolOutcome>(CODE);
+}
+
+// Writes the trace of _run as a counterexample, unless one was already found.
+static void sol_report_cex(SolRun const& _run)
+{
+    lock_guard<mutex> guard(g_solCexLock);
+    if (g_solFoundCex.exchange(true)) return;
+
+    string trace;
+    for (auto const& token : _run.tokens)
+    {
+        if (!trace.empty()) trace += " ";
+        trace += token;
+    }
+
+    cout << "assert";
+    if (_run.msg) cout << ": " << _run.msg;
+    cout << endl;
+    cout << "Transaction Count: " << _run.transactions + 1 << endl;
+    cout << "Trace: " << trace << endl;
+
+    ofstream cex(g_solCexPath);
+    cex << trace << endl;
+}
+
+// Expands _job by one transaction, in every possible way. Each new state is
+// pushed to _pool, if it is within the depth bound.
+static void sol_expand(
+    size_t _worker, SolJob const& _job, SolWorkPool & _pool, SolRun & _run
+)
+{
+    size_t const BASE = _job.path.size();
+    vector<uint32_t> prefix = _job.path;
+    while (!g_solFoundCex)
+    {
+        auto const OUTCOME = sol_execute(prefix, _job.depth + 1, _run);
+        if (OUTCOME == SolOutcome::ASSERT_FAILED)
+        {
+            sol_report_cex(_run);
+            _pool.stop();
+            return;
+        }
+
+        bool const IS_NEW = (OUTCOME == SolOutcome::STATE)
+            && g_solVisited->insert(_run.hash);
+        if (IS_NEW)
+        {
+            ++g_solStates;
+            if (_job.depth + 1 < g_solDepth)
+            {
+                SolJob child{ {}, _job.depth + 1 };
+                for (auto const& choice : _run.choices)
+                {
+                    child.path.push_back(choice.index);
+                }
+                _pool.push(_worker, move(child));
+            }
+        }
+
+        // Advances to the next sibling, by incrementing the last choice of this
+        // transaction which has not exhausted its domain.
+        size_t idx = _run.choices.size();
+        while (idx > BASE)
+        {
+            auto const& CHOICE = _run.choices[idx - 1];
+            if (CHOICE.index + 1 < CHOICE.domain) break;
+            --idx;
+        }
+        if (idx == BASE) return;
+
+        prefix.resize(idx);
+        for (size_t i = BASE; i < idx; ++i) prefix[i] = _run.choices[i].index;
+        ++prefix[idx - 1];
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+// Searches the state space with g_solThreads workers.
+static void sol_explore(void)
+{
+    g_solVisited.reset(new SolVisitedSet(g_solTableBits));
+
+    SolWorkPool pool(g_solThreads, g_solDfs);
+    pool.push(0, SolJob{ {}, 0 });
+
+    vector<thread> workers;
+    for (size_t i = 0; i < g_solThreads; ++i)
+    {
+        workers.emplace_back([i, &pool]() {
+            SolRun run;
+            SolJob job;
+            while (pool.pop(i, job))
+            {
+                sol_expand(i, job, pool, run);
+                pool.finish();
+            }
+        });
+    }
+    for (auto & worker : workers) worker.join();
+
+    cout << "States: " << g_solStates << endl;
+    cout << "Executions: " << g_solRuns << endl;
+    if (g_solVisited->overflowed())
+    {
+        cout << "Warning: the visited state table overflowed." << endl;
+    }
+    if (!g_solFoundCex)
+    {
+        cout << "No violations within " << g_solDepth << " transactions.";
+        cout << endl;
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+void sol_setup(int _argc, const char **_argv)
+{
+    po::options_description desc("Explicit-State Model Checker");
+    desc.add_options()
+        (g_solHelpCliArg, g_solHelpCliMsg)
+        (g_solThreadsCliArg,
+            po::value<unsigned>(&g_solThreads)->default_value(
+                max(1u, thread::hardware_concurrency())
+            ),
+            g_solThreadsCliMsg)
+        (g_solDepthCliArg,
+            po::value<uint32_t>(&g_solDepth)->default_value(4),
+            g_solDepthCliMsg)
+        (g_solValuesCliArg,
+            po::value<uint32_t>(&g_solValues)->default_value(2),
+            g_solValuesCliMsg)
+        (g_solDfsCliArg, po::bool_switch(&g_solDfs), g_solDfsCliMsg)
+        (g_solTableCliArg,
+            po::value<unsigned>(&g_solTableBits)->default_value(22),
+            g_solTableCliMsg)
+        (g_solCexCliArg,
+            po::value<string>(&g_solCexPath)->default_value("cex.txt"),
+            g_solCexCliMsg)
+        (g_solZRetCliArg, po::bool_switch(&g_solZRet), g_solZRetCliMsg);
+
+    po::variables_map args;
+    po::store(po::parse_command_line(_argc, _argv, desc), args);
+    po::notify(args);
+
+    if (args.count(g_solHelpCliArg))
+    {
+        cout << desc << endl;
+        exit(0);
+    }
+    if (g_solThreads == 0 || g_solValues == 0 || g_solTableBits > 40)
+    {
+        cerr << "Invalid search bounds." << endl;
+        exit(2);
+    }
+
+    // The search replaces the single execution started by the harness.
+    sol_explore();
+    exit((g_solFoundCex && !g_solZRet) ? 1 : 0);
+}
+
+// -------------------------------------------------------------------------- //
+
+uint8_t sol_continue(void)
+{
+    return sol_record<unsigned>(1);
+}
+
+void sol_on_transaction(void) {}
+
+void sol_on_state(uint64_t _hash)
+{
+    auto & run = *t_solRun;
+    ++run.transactions;
+    if (run.transactions == run.target)
+    {
+        run.hash = _hash;
+        sol_end_run(SolOutcome::STATE, nullptr);
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+void sol_assert(sol_raw_uint8_t _cond, const char* _msg)
+{
+    if (!_cond) sol_end_run(SolOutcome::ASSERT_FAILED, _msg);
+}
+
+void sol_require(sol_raw_uint8_t _cond, const char* _msg)
+{
+    if (!_cond) sol_end_run(SolOutcome::REQUIRE_FAILED, _msg);
+}
+
+void ll_assume(sol_raw_uint8_t _cond)
+{
+    if (!_cond) sol_end_run(SolOutcome::REQUIRE_FAILED, nullptr);
+}
+
+void sol_emit(const char*) {}
+
+void smartace_log(const char*) {}
+
+// -------------------------------------------------------------------------- //
+
+sol_raw_uint8_t sol_crypto(void)
+{
+    return nd_byte(0, nullptr);
+}
+
+sol_raw_uint256_t sol_hash_push(
+    sol_raw_uint256_t _prefix, sol_raw_uint256_t _word, uint8_t _bytes
+)
+{
+    return t_solHashModel.push(_prefix, _word, _bytes);
+}
+
+sol_raw_uint256_t sol_hash_final(uint8_t _fn, sol_raw_uint256_t _prefix)
+{
+    return t_solHashModel.digest(_fn, _prefix);
+}
+
+// -------------------------------------------------------------------------- //
+
+uint8_t nd_byte(int8_t, const char*)
+{
+    return sol_record<unsigned>(sol_choose(min<uint32_t>(g_solValues, 256)));
+}
+
+uint8_t nd_range(int8_t, uint8_t _l, uint8_t _u, const char*)
+{
+    if (_u <= _l) sol_end_run(SolOutcome::REQUIRE_FAILED, nullptr);
+    return sol_record<unsigned>(_l + sol_choose(_u - _l));
+}
+
+sol_raw_uint256_t nd_increase(
+    sol_raw_int256_t, sol_raw_uint256_t _curr, uint8_t _strict, const char*
+)
+{
+    sol_raw_uint256_t const DELTA = sol_choose(g_solValues) + _strict;
+    ll_assume(_curr <= SOL_UINT256_MAX - DELTA);
+    return sol_record(_curr + DELTA);
+}
+
+// Integers are drawn from the first g_solValues values, in order of magnitude.
+#define SOL_EXPLICIT_ND(__bits) \
+    sol_raw_int ## __bits ## _t nd_int ## __bits ## _t( \
+        sol_raw_int ## __bits ## _t, const char*) \
+    { \
+        return sol_record<int64_t>( \
+            (sol_raw_int ## __bits ## _t)(sol_choose_signed())); \
+    } \
+    sol_raw_uint ## __bits ## _t nd_uint ## __bits ## _t( \
+        sol_raw_int ## __bits ## _t, const char*) \
+    { \
+        return sol_record<uint64_t>( \
+            (sol_raw_uint ## __bits ## _t)(sol_choose(g_solValues))); \
+    }
+
+SOL_EXPLICIT_ND(8)
+SOL_EXPLICIT_ND(16)
+SOL_EXPLICIT_ND(24)
+SOL_EXPLICIT_ND(32)
+SOL_EXPLICIT_ND(40)
+SOL_EXPLICIT_ND(48)
+SOL_EXPLICIT_ND(56)
+SOL_EXPLICIT_ND(64)
+SOL_EXPLICIT_ND(72)
+SOL_EXPLICIT_ND(80)
+SOL_EXPLICIT_ND(88)
+SOL_EXPLICIT_ND(96)
+SOL_EXPLICIT_ND(104)
+SOL_EXPLICIT_ND(112)
+SOL_EXPLICIT_ND(120)
+SOL_EXPLICIT_ND(128)
+SOL_EXPLICIT_ND(136)
+SOL_EXPLICIT_ND(144)
+SOL_EXPLICIT_ND(152)
+SOL_EXPLICIT_ND(160)
+SOL_EXPLICIT_ND(168)
+SOL_EXPLICIT_ND(176)
+SOL_EXPLICIT_ND(184)
+SOL_EXPLICIT_ND(192)
+SOL_EXPLICIT_ND(200)
+SOL_EXPLICIT_ND(208)
+SOL_EXPLICIT_ND(216)
+SOL_EXPLICIT_ND(224)
+SOL_EXPLICIT_ND(232)
+SOL_EXPLICIT_ND(240)
+SOL_EXPLICIT_ND(248)
+SOL_EXPLICIT_ND(256)
+
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,177 @@
+/**
+ * Implements sol_hash_push and sol_hash_final for concrete backends. Each
+ * prefix is interned as the bytes it encodes, so that keccak256 is computed
+ * exactly, over the same bytes as abi.encodePacked. The other functions have no
+ * concrete implementation, and are instead modeled by keccak256 over a tagged
+ * input. These remain deterministic, but do not match the EVM.
+ *
+ * Digests are truncated to the width of sol_raw_uint256_t, keeping the low
+ * order bytes, as in a cast from bytes32 to uint256.
+ * @date 2020
+ */
+
+#pragma once
+
+#include "verify.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// -------------------------------------------------------------------------- //
+
+// Computes the Keccak-256 digest of _data, as used by the EVM. This differs from
+// SHA3-256 in its padding.
+static std::string sol_keccak256(std::string const& _data)
+{
+    static uint64_t const RC[24] = {
+        0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+        0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+        0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+        0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+        0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+        0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+        0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+        0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+    };
+    static unsigned int const ROT[24] = {
+        1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+        27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+    };
+    static unsigned int const LANE[24] = {
+        10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+        15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+    };
+    size_t const RATE = 136;
+
+    // Pads the input with 0x01 ... 0x80, to a multiple of the rate.
+    std::string msg = _data;
+    msg.push_back('\x01');
+    while (msg.size() % RATE != 0) msg.push_back('\0');
+    msg.back() = (char)(msg.back() | 0x80);
+
+    uint64_t state[25] = { 0 };
+    for (size_t block = 0; block < msg.size(); block += RATE)
+    {
+        for (size_t i = 0; i < RATE; ++i)
+        {
+            uint64_t const BYTE = (uint8_t)(msg[block + i]);
+            state[i / 8] ^= BYTE << (8 * (i % 8));
+        }
+
+        for (unsigned int round = 0; round < 24; ++round)
+        {
+            uint64_t c[5];
+            for (unsigned int x = 0; x < 5; ++x)
+            {
+                c[x] = state[x] ^ state[x + 5] ^ state[x + 10]
+                     ^ state[x + 15] ^ state[x + 20];
+            }
+            for (unsigned int x = 0; x < 5; ++x)
+            {
+                uint64_t const R = c[(x + 1) % 5];
+                uint64_t const D = c[(x + 4) % 5] ^ ((R << 1) | (R >> 63));
+                for (unsigned int y = 0; y < 25; y += 5) state[y + x] ^= D;
+            }
+
+            uint64_t carry = state[1];
+            for (unsigned int i = 0; i < 24; ++i)
+            {
+                uint64_t const NEXT = state[LANE[i]];
+                state[LANE[i]] = (carry << ROT[i]) | (carry >> (64 - ROT[i]));
+                carry = NEXT;
+            }
+
+            for (unsigned int y = 0; y < 25; y += 5)
+            {
+                for (unsigned int x = 0; x < 5; ++x) c[x] = state[y + x];
+                for (unsigned int x = 0; x < 5; ++x)
+                {
+                    state[y + x] = c[x] ^ ((~c[(x + 1) % 5]) & c[(x + 2) % 5]);
+                }
+            }
+
+            state[0] ^= RC[round];
+        }
+    }
+
+    std::string digest(32, '\0');
+    for (size_t i = 0; i < 32; ++i)
+    {
+        digest[i] = (char)(state[i / 8] >> (8 * (i % 8)));
+    }
+    return digest;
+}
+
+// -------------------------------------------------------------------------- //
+
+// Interns the bytes encoded by each prefix. Prefix 0 is the empty input.
+class SolHashModel
+{
+public:
+    SolHashModel() { reset(); }
+
+    // Forgets all prefixes.
+    void reset()
+    {
+        m_prefixes.assign(1, std::string());
+        m_ids.clear();
+    }
+
+    sol_raw_uint256_t push(
+        sol_raw_uint256_t _prefix, sol_raw_uint256_t _word, uint8_t _bytes
+    )
+    {
+        std::string data = lookup(_prefix);
+        for (unsigned int i = _bytes; i > 0; --i)
+        {
+            unsigned int byte = 0;
+            if (8 * (i - 1) < WORD_BITS)
+            {
+                byte = (unsigned int)((_word >> (8 * (i - 1))) & 0xFF);
+            }
+            data.push_back((char)(byte));
+        }
+
+        auto res = m_ids.emplace(data, m_prefixes.size());
+        if (res.second) m_prefixes.push_back(data);
+        return res.first->second;
+    }
+
+    sol_raw_uint256_t digest(uint8_t _fn, sol_raw_uint256_t _prefix)
+    {
+        std::string data = lookup(_prefix);
+        if (_fn != SOL_HASH_KECCAK256) data.insert(0, 1, (char)(_fn));
+
+        // The final digest is truncated to the width of the result.
+        size_t width = 32;
+        if (_fn == SOL_HASH_RIPEMD160 || _fn == SOL_HASH_ECRECOVER) width = 20;
+
+        std::string const DIGEST = sol_keccak256(data);
+        sol_raw_uint256_t result = 0;
+        for (size_t i = 32 - width; i < 32; ++i)
+        {
+            result = (result << 8) | (uint8_t)(DIGEST[i]);
+        }
+        return result;
+    }
+
+private:
+#ifdef MC_USE_STDINT
+    static constexpr unsigned int WORD_BITS = 8 * sizeof(sol_raw_uint256_t);
+#else
+    static constexpr unsigned int WORD_BITS = 256;
+#endif
+
+    std::vector<std::string> m_prefixes;
+    std::map<std::string, size_t> m_ids;
+
+    std::string const& lookup(sol_raw_uint256_t _prefix) const
+    {
+        if (_prefix >= m_prefixes.size()) return m_prefixes[0];
+        return m_prefixes[(size_t)(_prefix)];
+    }
+};
+
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,73 @@
+/**
+ * Implements sol_hash_push and sol_hash_final for symbolic backends. Each call
+ * returns a fresh value, unless its arguments match those of an earlier call,
+ * in which case the earlier result is returned. This is the usual encoding of
+ * an uninterpreted function.
+ *
+ * The including runtime must define sol_hash_fresh(), which returns a fresh
+ * symbolic value. Calls beyond SOL_HASH_TABLE_SIZE are not memoized, and only
+ * add behaviours to the model.
+ * @date 2020
+ */
+
+#pragma once
+
+#include "verify.h"
+
+#ifndef SOL_HASH_TABLE_SIZE
+#define SOL_HASH_TABLE_SIZE 64
+#endif
+
+static sol_raw_uint256_t sol_hash_fresh(void);
+
+// -------------------------------------------------------------------------- //
+
+static sol_raw_uint256_t g_solHashPrefix[SOL_HASH_TABLE_SIZE];
+static sol_raw_uint256_t g_solHashWord[SOL_HASH_TABLE_SIZE];
+static uint8_t g_solHashBytes[SOL_HASH_TABLE_SIZE];
+static sol_raw_uint256_t g_solHashResult[SOL_HASH_TABLE_SIZE];
+static unsigned int g_solHashSize = 0;
+
+// The final step is stored in the same table. As _bytes is never zero for a
+// word, a zero-byte entry denotes a final step, and its word is _fn.
+static sol_raw_uint256_t sol_hash_lookup(
+    sol_raw_uint256_t _prefix, sol_raw_uint256_t _word, uint8_t _bytes
+)
+{
+    for (unsigned int i = 0; i < g_solHashSize; ++i)
+    {
+        if (g_solHashPrefix[i] == _prefix
+            && g_solHashWord[i] == _word
+            && g_solHashBytes[i] == _bytes)
+        {
+            return g_solHashResult[i];
+        }
+    }
+
+    sol_raw_uint256_t result = sol_hash_fresh();
+    if (g_solHashSize < SOL_HASH_TABLE_SIZE)
+    {
+        g_solHashPrefix[g_solHashSize] = _prefix;
+        g_solHashWord[g_solHashSize] = _word;
+        g_solHashBytes[g_solHashSize] = _bytes;
+        g_solHashResult[g_solHashSize] = result;
+        ++g_solHashSize;
+    }
+    return result;
+}
+
+// -------------------------------------------------------------------------- //
+
+sol_raw_uint256_t sol_hash_push(
+    sol_raw_uint256_t _prefix, sol_raw_uint256_t _word, uint8_t _bytes
+)
+{
+    return sol_hash_lookup(_prefix, _word, _bytes);
+}
+
+sol_raw_uint256_t sol_hash_final(uint8_t _fn, sol_raw_uint256_t _prefix)
+{
+    return sol_hash_lookup(_prefix, _fn, 0);
+}
+
+// -------------------------------------------------------------------------- //
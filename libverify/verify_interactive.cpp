@@ -2,14 +2,31 @@
  * Defines an interactive implementation of assume and require. When either
  * assertation fails, the execution is halted, the reason is logged. If the
  * assertion was a requirement, then a non-zero return value is produced.
+ *
+ * In server mode, the model is instead replayed once per line of input. Each
+ * line is a complete trace, and the outcome of each trace is reported on its
+ * own line. Failures return control to the server rather than exiting. The
+ * same replay is used to minimize traces which violate an assertion.
  * @date 2019
  */
 
 #include "verify.h"
+#include "verify_hash_concrete.h"
 
+#include <csetjmp>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 #include <boost/program_options.hpp>
 
@@ -17,6 +34,71 @@ using namespace std;
 
 // -------------------------------------------------------------------------- //
 
+// The outcome of a single trace in server mode.
+// PASS: the trace terminated through sol_continue.
+// ASSERT_FAILED: an assertion failed during the trace.
+// REQUIRE_FAILED: a requirement or assumption failed during the trace.
+// OUT_OF_DATA: the trace ended before the model terminated.
+enum TraceOutcome { PASS, ASSERT_FAILED, REQUIRE_FAILED, OUT_OF_DATA };
+
+static char const* const g_solOutcomeNames[] = {
+    "pass", "assert", "require", "incomplete"
+};
+
+// The state to restore when a trace is aborted in server mode.
+static jmp_buf g_solTraceEnv;
+
+// The reason for the most recent failure in server mode, if any.
+static char const* g_solTraceMsg;
+
+// All nondeterministic values are read from this stream. In server mode, it
+// is replaced by the current trace.
+static istream* g_solInput = &cin;
+
+// The number of tokens consumed by the current trace.
+static size_t g_solTokensRead;
+
+// The token offset at which each transaction of the current trace begins.
+static vector<size_t> g_solTxnOffsets;
+
+// Aborts the current trace in server mode. Otherwise, this is a no-op.
+static void sol_abort_trace(TraceOutcome _outcome, char const* _msg);
+
+// Reads the next token of input into _dst.
+template <typename T>
+static void sol_read(T& _dst)
+{
+    *g_solInput >> _dst;
+    if (g_solInput->fail()) sol_abort_trace(OUT_OF_DATA, nullptr);
+    ++g_solTokensRead;
+}
+
+// Reads the next token of input as a byte-sized integer into _dst.
+template <typename T>
+static void sol_read_byte(T& _dst)
+{
+    unsigned int raw = 0;
+    sol_read(raw);
+    _dst = (T)(raw);
+}
+
+// Runs the model against a single trace, and returns its outcome.
+static TraceOutcome sol_replay(string const& _trace);
+
+// Runs the model against a single line of input, and reports its outcome.
+static string sol_run_trace(string const& _trace, uint64_t _id);
+
+// Minimizes the trace stored at _path, while preserving its failed assertion.
+static void sol_minimize(string const& _path);
+
+// Serves traces from stdin, until the end of input.
+static void sol_serve_stdin(void);
+
+// Serves traces from a unix socket bound to _path. This never returns.
+static void sol_serve_socket(string const& _path);
+
+// -------------------------------------------------------------------------- //
+
 static uint64_t g_solTransactionNumber;
 
 static const char g_solHelpCliArg[] = "help";
@@ -26,8 +108,16 @@ static const char g_solZRetCliMsg[] = "when true, assertions return 0";
 static const char g_solTransNCliArg[] = "count-transactions";
 static const char gTransNCliMsg[] = "when true, logs total transactions";
 
+static const char g_solServerCliArg[] = "server";
+static const char g_solServerCliMsg[] = "replay one trace per line of stdin";
+static const char g_solSocketCliArg[] = "socket";
+static const char g_solSocketCliMsg[] = "replay traces from a unix socket";
+static const char g_solMinCliArg[] = "minimize";
+static const char g_solMinCliMsg[] = "minimize the failing trace in a file";
+
 static bool g_solZRet;
 static bool g_solLogTrans;
+static bool g_solServer;
 
 void sol_setup(int _argc, const char **_argv)
 {
@@ -41,7 +131,10 @@ void sol_setup(int _argc, const char **_argv)
         desc.add_options()
             (g_solHelpCliArg, g_solHelpCliMsg)
             (g_solZRetCliArg, po::bool_switch(&g_solZRet), g_solZRetCliMsg)
-            (g_solTransNCliArg, po::bool_switch(&g_solLogTrans), gTransNCliMsg);
+            (g_solTransNCliArg, po::bool_switch(&g_solLogTrans), gTransNCliMsg)
+            (g_solServerCliArg, po::bool_switch(&g_solServer), g_solServerCliMsg)
+            (g_solSocketCliArg, po::value<string>(), g_solSocketCliMsg)
+            (g_solMinCliArg, po::value<string>(), g_solMinCliMsg);
     
         po::variables_map args;
         po::store(po::parse_command_line(_argc, _argv, desc), args);
@@ -52,6 +145,23 @@ void sol_setup(int _argc, const char **_argv)
             cout << desc << endl;
             exit(0);
         }
+
+        if (args.count(g_solMinCliArg))
+        {
+            g_solServer = true;
+            sol_minimize(args[g_solMinCliArg].as<string>());
+            exit(0);
+        }
+        else if (args.count(g_solSocketCliArg))
+        {
+            g_solServer = true;
+            sol_serve_socket(args[g_solSocketCliArg].as<string>());
+        }
+        else if (g_solServer)
+        {
+            sol_serve_stdin();
+            exit(0);
+        }
     }
     catch (exception const& e)
     {
@@ -72,10 +182,25 @@ sol_raw_uint8_t sol_crypto(void)
     return nd_byte(0, "Select crypto value");
 }
 
+static SolHashModel g_solHashModel;
+
+sol_raw_uint256_t sol_hash_push(
+    sol_raw_uint256_t _prefix, sol_raw_uint256_t _word, uint8_t _bytes
+)
+{
+    return g_solHashModel.push(_prefix, _word, _bytes);
+}
+
+sol_raw_uint256_t sol_hash_final(uint8_t _fn, sol_raw_uint256_t _prefix)
+{
+    return g_solHashModel.digest(_fn, _prefix);
+}
+
 // -------------------------------------------------------------------------- //
 
 uint8_t sol_continue(void)
 {
+	g_solTxnOffsets.push_back(g_solTokensRead);
 	return nd_byte(0, "Select 0 to terminate");
 }
 
@@ -101,6 +226,12 @@ void sol_assertion_impl(
 {
     if (!_cond)
     {
+        if (g_solServer)
+        {
+            bool is_assert = (strcmp(_check, "assert") == 0);
+            sol_abort_trace(is_assert ? ASSERT_FAILED : REQUIRE_FAILED, _msg);
+        }
+
         if (g_solZRet)
         {
             _status = 0;
@@ -136,6 +267,7 @@ void sol_require(sol_raw_uint8_t _cond, const char* _msg)
 
 void sol_emit(const char* _msg)
 {
+    if (g_solServer) return;
     cout << "Emit: " << _msg << endl;
 }
 
@@ -143,6 +275,7 @@ void sol_emit(const char* _msg)
 
 void smartace_log(const char* _msg)
 {
+	if (g_solServer) return;
 	cout << _msg << endl;
 }
 
@@ -150,25 +283,30 @@ void smartace_log(const char* _msg)
 
 void on_entry(const char* _type, const char* _msg)
 {
+    if (g_solServer) return;
+    if (!_msg) _msg = "Select value";
     cout << _msg << " [" << _type << "]: ";
 }
 
 uint8_t nd_byte(int8_t, const char* _msg)
 {
     on_entry("uint8", _msg);
-    uint8_t retval;
-    scanf("%hhu", &retval);
+    uint8_t retval = 0;
+    sol_read_byte(retval);
     return retval;
 }
 
 uint8_t nd_range(int8_t, uint8_t _l, uint8_t _u, const char* _msg)
 {
-    stringstream type;
-    type << "uint8 from " << unsigned(_l) << " to " << unsigned(_u - 1);
-    on_entry(type.str().c_str(), _msg);
+    if (!g_solServer)
+    {
+        stringstream type;
+        type << "uint8 from " << unsigned(_l) << " to " << unsigned(_u - 1);
+        on_entry(type.str().c_str(), _msg);
+    }
 
-    uint8_t retval;
-    scanf("%hhu", &retval);
+    uint8_t retval = 0;
+    sol_read_byte(retval);
 	ll_assume(retval >= _l);
 	ll_assume(retval < _u);
 	return retval;
@@ -179,11 +317,11 @@ uint8_t nd_range(int8_t, uint8_t _l, uint8_t _u, const char* _msg)
 #ifdef MC_USE_STDINT
 __int128_t nd_stdint_uint128_t(void)
 {
-    char input[40];
-    scanf("%s", input);
+    string input;
+    sol_read(input);
 
     __int128_t retval = 0;
-    for (unsigned int i = 0; input[i] != 0; ++i)
+    for (unsigned int i = 0; i < input.size(); ++i)
     {
         retval *= 10;
         retval += (__int128_t)(input[i] - '0');
@@ -200,7 +338,7 @@ sol_raw_uint256_t ll_nd_uint256_t(void)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -213,9 +351,12 @@ sol_raw_uint256_t nd_increase(
     const char* _msg
 )
 {
-    stringstream type;
-    type << "uint " << (_strict ? "larger" : "no less") << " than " << _curr;
-    on_entry(type.str().c_str(), _msg);
+    if (!g_solServer)
+    {
+        stringstream type;
+        type << "uint " << (_strict ? "larger" : "no less") << " than " << _curr;
+        on_entry(type.str().c_str(), _msg);
+    }
 
     sol_raw_uint256_t next = ll_nd_uint256_t();
 	if (_strict) ll_assume(next > _curr);
@@ -231,9 +372,9 @@ sol_raw_int8_t nd_int8_t(sol_raw_int8_t, const char* _msg)
     sol_raw_int8_t retval = 0;
 
     #ifdef MC_USE_STDINT
-    scanf("%hhu", &retval);
+    sol_read_byte(retval);
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -243,7 +384,7 @@ sol_raw_int16_t nd_int16_t(sol_raw_int16_t, const char* _msg)
 {
     on_entry("int16", _msg);
     sol_raw_int16_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -251,7 +392,7 @@ sol_raw_int24_t nd_int24_t(sol_raw_int24_t, const char* _msg)
 {
     on_entry("int24", _msg);
     sol_raw_int24_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -259,7 +400,7 @@ sol_raw_int32_t nd_int32_t(sol_raw_int32_t, const char* _msg)
 {
     on_entry("int32", _msg);
     sol_raw_int32_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -267,7 +408,7 @@ sol_raw_int40_t nd_int40_t(sol_raw_int40_t, const char* _msg)
 {
     on_entry("int40", _msg);
     sol_raw_int40_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -275,7 +416,7 @@ sol_raw_int48_t nd_int48_t(sol_raw_int48_t, const char* _msg)
 {
     on_entry("int48", _msg);
     sol_raw_int48_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -283,7 +424,7 @@ sol_raw_int56_t nd_int56_t(sol_raw_int56_t, const char* _msg)
 {
     on_entry("int56", _msg);
     sol_raw_int56_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -291,21 +432,21 @@ sol_raw_int64_t nd_int64_t(sol_raw_int64_t, const char* _msg)
 {
     on_entry("int64", _msg);
     sol_raw_int64_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
 #ifdef MC_USE_STDINT
 __int128_t nd_stdint_int128_t(void)
 {
-    char input[41];
-    scanf("%s", input);
+    string input;
+    sol_read(input);
 
     const int IS_NEG = (input[0] == '-');
     const int FIRST_DIGIT_POS = (IS_NEG ? 1 : 0);
 
     __int128_t retval = 0;
-    for (unsigned int i = FIRST_DIGIT_POS; input[i] != 0; ++i)
+    for (unsigned int i = FIRST_DIGIT_POS; i < input.size(); ++i)
     {
         retval *= 10;
         retval += (__int128_t)(input[i] - '0');
@@ -325,7 +466,7 @@ sol_raw_int72_t nd_int72_t(sol_raw_int72_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -339,7 +480,7 @@ sol_raw_int80_t nd_int80_t(sol_raw_int80_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -353,7 +494,7 @@ sol_raw_int88_t nd_int88_t(sol_raw_int88_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -367,7 +508,7 @@ sol_raw_int96_t nd_int96_t(sol_raw_int96_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -381,7 +522,7 @@ sol_raw_int104_t nd_int104_t(sol_raw_int104_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -395,7 +536,7 @@ sol_raw_int112_t nd_int112_t(sol_raw_int112_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -409,7 +550,7 @@ sol_raw_int120_t nd_int120_t(sol_raw_int120_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -423,7 +564,7 @@ sol_raw_int128_t nd_int128_t(sol_raw_int128_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -437,7 +578,7 @@ sol_raw_int136_t nd_int136_t(sol_raw_int136_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -451,7 +592,7 @@ sol_raw_int144_t nd_int144_t(sol_raw_int144_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -465,7 +606,7 @@ sol_raw_int152_t nd_int152_t(sol_raw_int152_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -479,7 +620,7 @@ sol_raw_int160_t nd_int160_t(sol_raw_int160_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -493,7 +634,7 @@ sol_raw_int168_t nd_int168_t(sol_raw_int168_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -507,7 +648,7 @@ sol_raw_int176_t nd_int176_t(sol_raw_int176_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -521,7 +662,7 @@ sol_raw_int184_t nd_int184_t(sol_raw_int184_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -535,7 +676,7 @@ sol_raw_int192_t nd_int192_t(sol_raw_int192_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -549,7 +690,7 @@ sol_raw_int200_t nd_int200_t(sol_raw_int200_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -563,7 +704,7 @@ sol_raw_int208_t nd_int208_t(sol_raw_int208_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -577,7 +718,7 @@ sol_raw_int216_t nd_int216_t(sol_raw_int216_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -591,7 +732,7 @@ sol_raw_int224_t nd_int224_t(sol_raw_int224_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -605,7 +746,7 @@ sol_raw_int232_t nd_int232_t(sol_raw_int232_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -619,7 +760,7 @@ sol_raw_int240_t nd_int240_t(sol_raw_int240_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -633,7 +774,7 @@ sol_raw_int248_t nd_int248_t(sol_raw_int248_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -647,7 +788,7 @@ sol_raw_int256_t nd_int256_t(sol_raw_int256_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_int128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -659,9 +800,9 @@ sol_raw_uint8_t nd_uint8_t(sol_raw_int8_t, const char* _msg)
     sol_raw_uint8_t retval = 0;
 
     #ifdef MC_USE_STDINT
-    scanf("%hhu", &retval);
+    sol_read_byte(retval);
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -671,7 +812,7 @@ sol_raw_uint16_t nd_uint16_t(sol_raw_int16_t, const char* _msg)
 {
     on_entry("uint16", _msg);
     sol_raw_uint16_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -679,7 +820,7 @@ sol_raw_uint24_t nd_uint24_t(sol_raw_int24_t, const char* _msg)
 {
     on_entry("uint24", _msg);
     sol_raw_uint24_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -687,7 +828,7 @@ sol_raw_uint32_t nd_uint32_t(sol_raw_int32_t, const char* _msg)
 {
     on_entry("uint32", _msg);
     sol_raw_uint32_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -695,7 +836,7 @@ sol_raw_uint40_t nd_uint40_t(sol_raw_int40_t, const char* _msg)
 {
     on_entry("uint40", _msg);
     sol_raw_uint40_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -703,7 +844,7 @@ sol_raw_uint48_t nd_uint48_t(sol_raw_int48_t, const char* _msg)
 {
     on_entry("uint48", _msg);
     sol_raw_uint48_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -711,7 +852,7 @@ sol_raw_uint56_t nd_uint56_t(sol_raw_int56_t, const char* _msg)
 {
     on_entry("uint56", _msg);
     sol_raw_uint56_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -719,7 +860,7 @@ sol_raw_uint64_t nd_uint64_t(sol_raw_int64_t, const char* _msg)
 {
     on_entry("uint64", _msg);
     sol_raw_uint64_t retval = 0;
-    cin >> retval;
+    sol_read(retval);
     return retval;
 }
 
@@ -731,7 +872,7 @@ sol_raw_uint72_t nd_uint72_t(sol_raw_int72_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -745,7 +886,7 @@ sol_raw_uint80_t nd_uint80_t(sol_raw_int80_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -759,7 +900,7 @@ sol_raw_uint88_t nd_uint88_t(sol_raw_int88_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -773,7 +914,7 @@ sol_raw_uint96_t nd_uint96_t(sol_raw_int96_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -787,7 +928,7 @@ sol_raw_uint104_t nd_uint104_t(sol_raw_int104_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -801,7 +942,7 @@ sol_raw_uint112_t nd_uint112_t(sol_raw_int112_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -815,7 +956,7 @@ sol_raw_uint120_t nd_uint120_t(sol_raw_int120_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -829,7 +970,7 @@ sol_raw_uint128_t nd_uint128_t(sol_raw_int128_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -843,7 +984,7 @@ sol_raw_uint136_t nd_uint136_t(sol_raw_int136_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -857,7 +998,7 @@ sol_raw_uint144_t nd_uint144_t(sol_raw_int144_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -871,7 +1012,7 @@ sol_raw_uint152_t nd_uint152_t(sol_raw_int152_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -885,7 +1026,7 @@ sol_raw_uint160_t nd_uint160_t(sol_raw_int160_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -899,7 +1040,7 @@ sol_raw_uint168_t nd_uint168_t(sol_raw_int168_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -913,7 +1054,7 @@ sol_raw_uint176_t nd_uint176_t(sol_raw_int176_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -927,7 +1068,7 @@ sol_raw_uint184_t nd_uint184_t(sol_raw_int184_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -941,7 +1082,7 @@ sol_raw_uint192_t nd_uint192_t(sol_raw_int192_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -955,7 +1096,7 @@ sol_raw_uint200_t nd_uint200_t(sol_raw_int200_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -969,7 +1110,7 @@ sol_raw_uint208_t nd_uint208_t(sol_raw_int208_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -983,7 +1124,7 @@ sol_raw_uint216_t nd_uint216_t(sol_raw_int216_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -997,7 +1138,7 @@ sol_raw_uint224_t nd_uint224_t(sol_raw_int224_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -1011,7 +1152,7 @@ sol_raw_uint232_t nd_uint232_t(sol_raw_int232_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -1025,7 +1166,7 @@ sol_raw_uint240_t nd_uint240_t(sol_raw_int240_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -1039,7 +1180,7 @@ sol_raw_uint248_t nd_uint248_t(sol_raw_int248_t, const char* _msg)
     #ifdef MC_USE_STDINT
     retval = nd_stdint_uint128_t();
     #elif defined MC_USE_BOOST_MP
-    std::cin >> retval;
+    sol_read(retval);
     #endif
 
     return retval;
@@ -1052,3 +1193,346 @@ sol_raw_uint256_t nd_uint256_t(sol_raw_int256_t, const char* _msg)
 }
 
 // -------------------------------------------------------------------------- //
+
+// -------------------------------------------------------------------------- //
+
+static void sol_abort_trace(TraceOutcome _outcome, char const* _msg)
+{
+    if (!g_solServer) return;
+    g_solTraceMsg = _msg;
+    longjmp(g_solTraceEnv, _outcome);
+}
+
+// -------------------------------------------------------------------------- //
+
+static TraceOutcome sol_replay(string const& _trace)
+{
+    istringstream trace(_trace);
+    g_solInput = &trace;
+    g_solTraceMsg = nullptr;
+    g_solTransactionNumber = 0;
+    g_solTokensRead = 0;
+    g_solTxnOffsets.clear();
+    g_solHashModel.reset();
+
+    // All model state is local to run_model, or is reset by run_model, so each
+    // trace starts from a fresh state.
+    int outcome = setjmp(g_solTraceEnv);
+    if (outcome == PASS)
+    {
+        run_model();
+    }
+    g_solInput = &cin;
+
+    return (TraceOutcome)(outcome);
+}
+
+static string sol_run_trace(string const& _trace, uint64_t _id)
+{
+    auto outcome = sol_replay(_trace);
+
+    stringstream report;
+    report << _id << " " << g_solOutcomeNames[outcome]
+           << " " << g_solTransactionNumber;
+    if (g_solTraceMsg)
+    {
+        report << " " << g_solTraceMsg;
+    }
+    report << "\n";
+    return report.str();
+}
+
+// -------------------------------------------------------------------------- //
+
+static void sol_serve_stdin(void)
+{
+    uint64_t id = 0;
+    string line;
+    while (getline(cin, line))
+    {
+        cout << sol_run_trace(line, id++) << flush;
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+static void sol_serve_socket(string const& _path)
+{
+    sockaddr_un addr;
+    if (_path.size() >= sizeof(addr.sun_path))
+    {
+        throw runtime_error("Socket path is too long: " + _path);
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, _path.c_str(), sizeof(addr.sun_path) - 1);
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server < 0)
+    {
+        throw runtime_error("Unable to open socket: " + _path);
+    }
+
+    unlink(_path.c_str());
+    if (bind(server, (sockaddr*)(&addr), sizeof(addr)) < 0
+        || listen(server, 1) < 0)
+    {
+        throw runtime_error("Unable to bind socket: " + _path);
+    }
+
+    // Clients are served in order. Each client may submit any number of traces,
+    // and the trace counter is reset for each client.
+    while (true)
+    {
+        int client = accept(server, nullptr, nullptr);
+        if (client < 0) continue;
+
+        uint64_t id = 0;
+        string pending;
+        char buffer[4096];
+        ssize_t len;
+        while ((len = read(client, buffer, sizeof(buffer))) > 0)
+        {
+            pending.append(buffer, len);
+
+            size_t end;
+            while ((end = pending.find('\n')) != string::npos)
+            {
+                string report = sol_run_trace(pending.substr(0, end), id++);
+                pending.erase(0, end + 1);
+                if (write(client, report.data(), report.size()) < 0) break;
+            }
+        }
+
+        close(client);
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+// Tracks the smallest known trace which violates a given assertion.
+class TraceMinimizer
+{
+public:
+    // Replays _tokens, to determine which assertion it violates.
+    explicit TraceMinimizer(vector<string> _tokens): m_tokens(move(_tokens))
+    {
+        if (sol_replay(join(m_tokens)) != ASSERT_FAILED)
+        {
+            throw runtime_error("Trace does not violate an assertion.");
+        }
+        m_msg = (g_solTraceMsg ? g_solTraceMsg : "");
+        trim();
+    }
+
+    // Repeats each reduction until none of them make progress.
+    void run()
+    {
+        size_t last_size;
+        do
+        {
+            last_size = m_tokens.size();
+            drop_transactions();
+            drop_chunks();
+            shrink_values();
+        }
+        while (m_tokens.size() < last_size);
+    }
+
+    vector<string> const& tokens() const { return m_tokens; }
+    size_t transactions() const { return m_txns; }
+    size_t replays() const { return m_replays; }
+    string const& message() const { return m_msg; }
+
+    static string join(vector<string> const& _tokens)
+    {
+        stringstream out;
+        for (size_t i = 0; i < _tokens.size(); ++i)
+        {
+            if (i > 0) out << " ";
+            out << _tokens[i];
+        }
+        return out.str();
+    }
+
+private:
+    vector<string> m_tokens;
+    vector<size_t> m_offsets;
+    size_t m_txns = 0;
+    size_t m_replays = 0;
+    string m_msg;
+
+    // Returns true if _tokens still violates the original assertion. If so,
+    // _tokens becomes the current trace.
+    bool accept(vector<string> const& _tokens)
+    {
+        ++m_replays;
+        if (sol_replay(join(_tokens)) != ASSERT_FAILED) return false;
+        if (m_msg != (g_solTraceMsg ? g_solTraceMsg : "")) return false;
+
+        m_tokens = _tokens;
+        trim();
+        return true;
+    }
+
+    // Drops all tokens read after the assertion failed in the last replay.
+    void trim()
+    {
+        m_tokens.resize(g_solTokensRead);
+        m_offsets = g_solTxnOffsets;
+        m_txns = g_solTransactionNumber;
+    }
+
+    // Attempts to remove each transaction, starting from the last.
+    void drop_transactions()
+    {
+        for (size_t i = m_offsets.size(); i > 0; --i)
+        {
+            if (i > m_offsets.size()) continue;
+
+            size_t start = m_offsets[i - 1];
+            size_t end = (i < m_offsets.size()) ? m_offsets[i] : m_tokens.size();
+            if (start >= end) continue;
+
+            auto candidate = m_tokens;
+            candidate.erase(candidate.begin() + start, candidate.begin() + end);
+            accept(candidate);
+        }
+    }
+
+    // Removes contiguous chunks of tokens, following ddmin.
+    void drop_chunks()
+    {
+        size_t granularity = 2;
+        while (m_tokens.size() >= 2)
+        {
+            size_t chunk = max<size_t>(m_tokens.size() / granularity, 1);
+
+            bool reduced = false;
+            for (size_t start = 0; start < m_tokens.size(); start += chunk)
+            {
+                auto candidate = m_tokens;
+                auto first = candidate.begin() + start;
+                auto last = first + min(chunk, m_tokens.size() - start);
+                candidate.erase(first, last);
+                if (accept(candidate))
+                {
+                    reduced = true;
+                    break;
+                }
+            }
+
+            if (reduced)
+            {
+                granularity = max<size_t>(granularity - 1, 2);
+            }
+            else if (chunk == 1)
+            {
+                break;
+            }
+            else
+            {
+                granularity = min(granularity * 2, m_tokens.size());
+            }
+        }
+    }
+
+    // Moves each value towards zero, by binary search.
+    void shrink_values()
+    {
+        for (size_t i = 0; i < m_tokens.size(); ++i)
+        {
+            auto candidate = m_tokens;
+            candidate[i] = "0";
+            if (m_tokens[i] == "0" || accept(candidate)) continue;
+
+            // Invariant: _lo was rejected, and m_tokens[i] was accepted.
+            string lo = "0";
+            while (i < m_tokens.size())
+            {
+                string mid = midpoint(lo, m_tokens[i]);
+                if (mid == lo || mid == m_tokens[i]) break;
+
+                candidate = m_tokens;
+                candidate[i] = mid;
+                if (!accept(candidate)) lo = mid;
+            }
+        }
+    }
+
+    // Returns the midpoint of _lo and _hi, rounded towards _lo. It is assumed
+    // that _lo lies between 0 and _hi. If _hi is not a decimal integer, then
+    // _hi is returned.
+    static string midpoint(string const& _lo, string const& _hi)
+    {
+        bool neg = (!_hi.empty() && _hi[0] == '-');
+        string hi = _hi.substr(neg ? 1 : 0);
+        string lo = _lo.substr((!_lo.empty() && _lo[0] == '-') ? 1 : 0);
+        if (hi.empty()) return _hi;
+        for (char c : hi)
+        {
+            if (c < '0' || c > '9') return _hi;
+        }
+
+        string half;
+        unsigned int carry = 0;
+        for (char c : add(lo, hi))
+        {
+            unsigned int d = carry * 10 + (c - '0');
+            half.push_back('0' + d / 2);
+            carry = d % 2;
+        }
+        half.erase(0, min(half.find_first_not_of('0'), half.size() - 1));
+
+        return (neg && half != "0" ? "-" : "") + half;
+    }
+
+    // Adds two non-negative decimal integers.
+    static string add(string const& _a, string const& _b)
+    {
+        string sum;
+        unsigned int carry = 0;
+        auto a = _a.rbegin();
+        auto b = _b.rbegin();
+        while (a != _a.rend() || b != _b.rend() || carry > 0)
+        {
+            unsigned int d = carry;
+            if (a != _a.rend()) d += (*(a++) - '0');
+            if (b != _b.rend()) d += (*(b++) - '0');
+            sum.push_back('0' + d % 10);
+            carry = d / 10;
+        }
+        return string(sum.rbegin(), sum.rend());
+    }
+};
+
+static void sol_minimize(string const& _path)
+{
+    ifstream file(_path);
+    if (!file)
+    {
+        throw runtime_error("Unable to open trace: " + _path);
+    }
+
+    vector<string> tokens{
+        istream_iterator<string>(file), istream_iterator<string>()
+    };
+    size_t original_size = tokens.size();
+
+    TraceMinimizer minimizer(move(tokens));
+    minimizer.run();
+
+    cout << TraceMinimizer::join(minimizer.tokens()) << endl;
+    cerr << "assert";
+    if (!minimizer.message().empty())
+    {
+        cerr << ": " << minimizer.message();
+    }
+    cerr << endl
+         << "Reduced " << original_size << " values to "
+         << minimizer.tokens().size() << " (" << minimizer.transactions()
+         << " transactions) in " << minimizer.replays() << " replays." << endl;
+}
+
+// -------------------------------------------------------------------------- //
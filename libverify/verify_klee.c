@@ -12,6 +12,10 @@
 #include <stdint.h>
 #include <assert.h>
 
+// KLEE requires a name for each symbolic value. If descriptions were compiled
+// out (see MC_LOG_LEVEL), then a generic name is used instead.
+#define SOL_KLEE_NAME(__msg) ((__msg) ? (__msg) : "nd")
+
 // -------------------------------------------------------------------------- //
 
 sol_raw_uint8_t sol_crypto(void)
@@ -19,6 +23,15 @@ sol_raw_uint8_t sol_crypto(void)
     return nd_byte(0, "Select crypto value");
 }
 
+#include "verify_hash_symbolic.h"
+
+static sol_raw_uint256_t sol_hash_fresh(void)
+{
+    sol_raw_uint256_t res;
+    klee_make_symbolic(&res, sizeof(res), "hash");
+    return res;
+}
+
 // -------------------------------------------------------------------------- //
 
 void sol_setup(int _argc, const char **_argv) {}
@@ -63,7 +76,7 @@ uint8_t nd_byte(int8_t tmp, const char* _msg)
 {
 	(void) tmp;
     uint8_t res;
-    klee_make_symbolic(&res, sizeof(res), _msg);
+    klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
     return res;
 }
 
@@ -71,7 +84,7 @@ uint8_t nd_range(int8_t tmp, uint8_t l, uint8_t u, const char* _msg)
 {
 	(void) tmp;
     uint8_t res;
-    klee_make_symbolic(&res, sizeof(res), _msg);
+    klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	ll_assume(res >= l);
 	ll_assume(res < u);
     return res;
@@ -103,7 +116,7 @@ sol_raw_int8_t nd_int8_t(sol_raw_int8_t tmp, const char* _msg)
 {
 	(void) tmp;
     sol_raw_int8_t res;
-    klee_make_symbolic(&res, sizeof(res), _msg);
+    klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
     return res;
 }
 
@@ -111,7 +124,7 @@ sol_raw_uint8_t nd_uint8_t(sol_raw_int8_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint8_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -119,7 +132,7 @@ sol_raw_int16_t nd_int16_t(sol_raw_int16_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int16_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -127,7 +140,7 @@ sol_raw_uint16_t nd_uint16_t(sol_raw_int16_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint16_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -135,7 +148,7 @@ sol_raw_int24_t nd_int24_t(sol_raw_int24_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int24_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -143,7 +156,7 @@ sol_raw_uint24_t nd_uint24_t(sol_raw_int24_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint24_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -151,7 +164,7 @@ sol_raw_int32_t nd_int32_t(sol_raw_int32_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int32_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -159,7 +172,7 @@ sol_raw_uint32_t nd_uint32_t(sol_raw_int32_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint32_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -167,7 +180,7 @@ sol_raw_int40_t nd_int40_t(sol_raw_int40_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int40_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -175,7 +188,7 @@ sol_raw_uint40_t nd_uint40_t(sol_raw_int40_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint40_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -183,7 +196,7 @@ sol_raw_int48_t nd_int48_t(sol_raw_int48_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int48_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -191,7 +204,7 @@ sol_raw_uint48_t nd_uint48_t(sol_raw_int48_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint48_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -199,7 +212,7 @@ sol_raw_int56_t nd_int56_t(sol_raw_int56_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int56_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -207,7 +220,7 @@ sol_raw_uint56_t nd_uint56_t(sol_raw_int56_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint56_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -215,7 +228,7 @@ sol_raw_int64_t nd_int64_t(sol_raw_int64_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int64_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -223,7 +236,7 @@ sol_raw_uint64_t nd_uint64_t(sol_raw_int64_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint64_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -231,7 +244,7 @@ sol_raw_int72_t nd_int72_t(sol_raw_int72_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int72_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -239,7 +252,7 @@ sol_raw_uint72_t nd_uint72_t(sol_raw_int72_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint72_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -247,7 +260,7 @@ sol_raw_int80_t nd_int80_t(sol_raw_int80_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int80_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -255,7 +268,7 @@ sol_raw_uint80_t nd_uint80_t(sol_raw_int80_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint80_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -263,7 +276,7 @@ sol_raw_int88_t nd_int88_t(sol_raw_int88_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int88_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -271,7 +284,7 @@ sol_raw_uint88_t nd_uint88_t(sol_raw_int88_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint88_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -279,7 +292,7 @@ sol_raw_int96_t nd_int96_t(sol_raw_int96_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int96_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -287,7 +300,7 @@ sol_raw_uint96_t nd_uint96_t(sol_raw_int96_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint96_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -295,7 +308,7 @@ sol_raw_int104_t nd_int104_t(sol_raw_int104_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int104_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -303,7 +316,7 @@ sol_raw_uint104_t nd_uint104_t(sol_raw_int104_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint104_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -311,7 +324,7 @@ sol_raw_int112_t nd_int112_t(sol_raw_int112_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int112_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -319,7 +332,7 @@ sol_raw_uint112_t nd_uint112_t(sol_raw_int112_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint112_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -327,7 +340,7 @@ sol_raw_int120_t nd_int120_t(sol_raw_int120_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int120_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -335,7 +348,7 @@ sol_raw_uint120_t nd_uint120_t(sol_raw_int120_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint120_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -343,7 +356,7 @@ sol_raw_int128_t nd_int128_t(sol_raw_int128_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int128_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -351,7 +364,7 @@ sol_raw_uint128_t nd_uint128_t(sol_raw_int128_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint128_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -359,7 +372,7 @@ sol_raw_int136_t nd_int136_t(sol_raw_int136_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int136_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -367,7 +380,7 @@ sol_raw_uint136_t nd_uint136_t(sol_raw_int136_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint136_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -375,7 +388,7 @@ sol_raw_int144_t nd_int144_t(sol_raw_int144_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int144_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -383,7 +396,7 @@ sol_raw_uint144_t nd_uint144_t(sol_raw_int144_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint144_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -391,7 +404,7 @@ sol_raw_int152_t nd_int152_t(sol_raw_int152_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int152_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -399,7 +412,7 @@ sol_raw_uint152_t nd_uint152_t(sol_raw_int152_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint152_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -407,7 +420,7 @@ sol_raw_int160_t nd_int160_t(sol_raw_int160_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int160_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -415,7 +428,7 @@ sol_raw_uint160_t nd_uint160_t(sol_raw_int160_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint160_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -423,7 +436,7 @@ sol_raw_int168_t nd_int168_t(sol_raw_int168_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int168_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -431,7 +444,7 @@ sol_raw_uint168_t nd_uint168_t(sol_raw_int168_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint168_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -439,7 +452,7 @@ sol_raw_int176_t nd_int176_t(sol_raw_int176_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int176_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -447,7 +460,7 @@ sol_raw_uint176_t nd_uint176_t(sol_raw_int176_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint176_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -455,7 +468,7 @@ sol_raw_int184_t nd_int184_t(sol_raw_int184_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int184_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -463,7 +476,7 @@ sol_raw_uint184_t nd_uint184_t(sol_raw_int184_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint184_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -471,7 +484,7 @@ sol_raw_int192_t nd_int192_t(sol_raw_int192_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int192_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -479,7 +492,7 @@ sol_raw_uint192_t nd_uint192_t(sol_raw_int192_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint192_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -487,7 +500,7 @@ sol_raw_int200_t nd_int200_t(sol_raw_int200_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int200_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -495,7 +508,7 @@ sol_raw_uint200_t nd_uint200_t(sol_raw_int200_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint200_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -503,7 +516,7 @@ sol_raw_int208_t nd_int208_t(sol_raw_int208_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int208_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -511,7 +524,7 @@ sol_raw_uint208_t nd_uint208_t(sol_raw_int208_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint208_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -519,7 +532,7 @@ sol_raw_int216_t nd_int216_t(sol_raw_int216_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int216_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -527,7 +540,7 @@ sol_raw_uint216_t nd_uint216_t(sol_raw_int216_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint216_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -535,7 +548,7 @@ sol_raw_int224_t nd_int224_t(sol_raw_int224_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int224_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -543,7 +556,7 @@ sol_raw_uint224_t nd_uint224_t(sol_raw_int224_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint224_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -551,7 +564,7 @@ sol_raw_int232_t nd_int232_t(sol_raw_int232_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int232_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -559,7 +572,7 @@ sol_raw_uint232_t nd_uint232_t(sol_raw_int232_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint232_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -567,7 +580,7 @@ sol_raw_int240_t nd_int240_t(sol_raw_int240_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int240_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -575,7 +588,7 @@ sol_raw_uint240_t nd_uint240_t(sol_raw_int240_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint240_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -583,7 +596,7 @@ sol_raw_int248_t nd_int248_t(sol_raw_int248_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int248_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -591,7 +604,7 @@ sol_raw_uint248_t nd_uint248_t(sol_raw_int248_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint248_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -599,7 +612,7 @@ sol_raw_int256_t nd_int256_t(sol_raw_int256_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_int256_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
@@ -607,7 +620,7 @@ sol_raw_uint256_t nd_uint256_t(sol_raw_int256_t tmp, const char* _msg)
 {
 	(void) tmp;
 	sol_raw_uint256_t res;
-	klee_make_symbolic(&res, sizeof(res), _msg);
+	klee_make_symbolic(&res, sizeof(res), SOL_KLEE_NAME(_msg));
 	return res;
 }
 
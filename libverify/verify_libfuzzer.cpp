@@ -5,6 +5,7 @@
  */
 
 #include "verify.h"
+#include "verify_hash_concrete.h"
 
 #include <cassert>
 #include <csetjmp>
@@ -62,6 +63,21 @@ sol_raw_uint8_t sol_crypto(void)
     return nd_byte(0, "Select crypto value");
 }
 
+// The hash model is reset for each input.
+static SolHashModel g_solHashModel;
+
+sol_raw_uint256_t sol_hash_push(
+    sol_raw_uint256_t _prefix, sol_raw_uint256_t _word, uint8_t _bytes
+)
+{
+    return g_solHashModel.push(_prefix, _word, _bytes);
+}
+
+sol_raw_uint256_t sol_hash_final(uint8_t _fn, sol_raw_uint256_t _prefix)
+{
+    return g_solHashModel.digest(_fn, _prefix);
+}
+
 // -------------------------------------------------------------------------- //
 
 void sol_setup(int _argc, const char **_argv) {}
@@ -79,6 +95,21 @@ void sol_on_transaction(void) {}
 
 // -------------------------------------------------------------------------- //
 
+// Each coverage hash is bucketed into one of the extra coverage counters. These
+// counters are cleared by libFuzzer before each input, so an input is kept if
+// it reaches a state (modulo collisions) which no prior input has reached.
+#define SOL_STATE_COUNTERS (1 << 16)
+__attribute__((used, section("__libfuzzer_extra_counters")))
+static uint8_t g_solStateCounters[SOL_STATE_COUNTERS];
+
+void sol_on_state(uint64_t _hash)
+{
+	uint8_t & counter = g_solStateCounters[_hash % SOL_STATE_COUNTERS];
+	if (counter < UINT8_MAX) ++counter;
+}
+
+// -------------------------------------------------------------------------- //
+
 void sol_assert(sol_raw_uint8_t _cond, const char* _msg)
 {
     if (!_cond)
@@ -209,6 +240,7 @@ void ran(uint8_t const* Data, size_t Size)
 extern "C" int LLVMFuzzerTestOneInput(uint8_t const* Data, size_t Size)
 {
 	exception_type = NONE;
+	g_solHashModel.reset();
 
 	switch(SetupExploration())
 	{
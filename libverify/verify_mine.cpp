@@ -0,0 +1,320 @@
+/**
+ * Mines candidate invariants from the snapshots reported by a concrete runtime.
+ * This file is linked alongside the libFuzzer runtime, so that replaying the
+ * corpus reports a snapshot of the model after setup and after each successful
+ * transaction. When the process exits, all candidates which held in every
+ * snapshot are written to invariants.h as SOL_LEMMAS.
+ *
+ * The candidates are intentionally simple:
+ * - a scalar or sum which never changed is equal to its observed value;
+ * - a scalar or sum whose extreme value was observed often is bounded by it;
+ * - two scalars which always agreed are equal;
+ * - a scalar and a map sum which were always ordered are ordered;
+ * - each map entry is at most the sum of its map.
+ * If a map has no sum field, then the sum of its entries is used instead.
+ * @date 2020
+ */
+
+#ifndef MC_USE_STDINT
+#error The invariant miner requires the stdint integer model.
+#endif
+
+#include "verify.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// -------------------------------------------------------------------------- //
+
+// The path to which invariants are written, relative to the working directory.
+#ifndef MC_INVARIANTS_FILE
+#define MC_INVARIANTS_FILE "invariants.h"
+#endif
+
+// The number of snapshots which must attain a bound before it is proposed.
+static const size_t SOL_BOUND_SUPPORT = 3;
+
+// The number of snapshots required before any lemma is proposed.
+static const size_t SOL_MIN_SNAPSHOTS = 2;
+
+// Pairwise relations, which are cleared once a snapshot refutes them.
+static const uint8_t SOL_REL_EQ = 1;
+static const uint8_t SOL_REL_LE = 2;
+static const uint8_t SOL_REL_GE = 4;
+
+// A labeled word of actor state.
+struct SolLabel
+{
+    string expr;
+    uint8_t kind;
+    uint32_t group;
+};
+
+// The range of values taken by a single word.
+struct SolRange
+{
+    sol_raw_uint256_t lo;
+    sol_raw_uint256_t hi;
+    size_t lo_hits;
+    size_t hi_hits;
+};
+
+/**
+ * Accumulates snapshots, and writes the surviving candidates on destruction.
+ * The labels of the first snapshot fix the layout of all others. A snapshot
+ * with a different layout is discarded.
+ */
+class SolMiner
+{
+public:
+    ~SolMiner() { write(MC_INVARIANTS_FILE); }
+
+    void begin() { m_curr.clear(); m_curr_labels.clear(); }
+
+    void observe(SolLabel _label, sol_raw_uint256_t _val)
+    {
+        m_curr_labels.push_back(move(_label));
+        m_curr.push_back(_val);
+    }
+
+    void end()
+    {
+        if (m_snapshots == 0)
+        {
+            m_labels = m_curr_labels;
+            add_virtual_sums();
+        }
+        else if (m_curr_labels.size() + m_virtual.size() != m_labels.size())
+        {
+            return;
+        }
+
+        for (auto const& entries : m_virtual)
+        {
+            sol_raw_uint256_t sum = 0;
+            for (auto i : entries.second) sum += m_curr[i];
+            m_curr.push_back(sum);
+        }
+
+        if (m_snapshots == 0) initialize();
+        else update();
+        ++m_snapshots;
+    }
+
+private:
+    size_t m_snapshots = 0;
+
+    vector<SolLabel> m_labels;
+    vector<SolLabel> m_curr_labels;
+    vector<sol_raw_uint256_t> m_curr;
+
+    // Maps each group without a sum field to the indices of its entries.
+    map<uint32_t, vector<size_t>> m_virtual;
+
+    vector<SolRange> m_ranges;
+    vector<vector<uint8_t>> m_rels;
+    vector<bool> m_below_sum;
+    map<uint32_t, size_t> m_sums;
+
+    // Labels the sum of each map without a sum field.
+    void add_virtual_sums()
+    {
+        map<uint32_t, bool> has_sum;
+        for (size_t i = 0; i < m_labels.size(); ++i)
+        {
+            auto const& LABEL = m_labels[i];
+            if (LABEL.kind == SOL_OBSERVE_ENTRY)
+            {
+                m_virtual[LABEL.group].push_back(i);
+            }
+            else if (LABEL.kind == SOL_OBSERVE_SUM)
+            {
+                has_sum[LABEL.group] = true;
+            }
+        }
+
+        for (auto const& entry : has_sum) m_virtual.erase(entry.first);
+
+        for (auto const& entries : m_virtual)
+        {
+            string expr;
+            for (auto i : entries.second)
+            {
+                expr += (expr.empty() ? "(" : " + ") + m_labels[i].expr;
+            }
+            expr += ")";
+            m_labels.push_back({ expr, SOL_OBSERVE_SUM, entries.first });
+        }
+    }
+
+    void initialize()
+    {
+        m_ranges.resize(m_labels.size());
+        m_rels.resize(m_labels.size());
+        m_below_sum.assign(m_labels.size(), true);
+        for (size_t i = 0; i < m_labels.size(); ++i)
+        {
+            m_ranges[i] = { m_curr[i], m_curr[i], 0, 0 };
+            m_rels[i].assign(
+                m_labels.size(), SOL_REL_EQ | SOL_REL_LE | SOL_REL_GE
+            );
+            if (m_labels[i].kind == SOL_OBSERVE_SUM)
+            {
+                m_sums[m_labels[i].group] = i;
+            }
+        }
+        update();
+    }
+
+    void update()
+    {
+        for (size_t i = 0; i < m_labels.size(); ++i)
+        {
+            auto const VAL = m_curr[i];
+            auto & range = m_ranges[i];
+            if (VAL < range.lo) range = { VAL, range.hi, 0, range.hi_hits };
+            if (VAL > range.hi) range = { range.lo, VAL, range.lo_hits, 0 };
+            if (VAL == range.lo) ++range.lo_hits;
+            if (VAL == range.hi) ++range.hi_hits;
+
+            for (size_t j = i + 1; j < m_labels.size(); ++j)
+            {
+                auto & rel = m_rels[i][j];
+                if (VAL != m_curr[j]) rel &= ~SOL_REL_EQ;
+                if (VAL > m_curr[j]) rel &= ~SOL_REL_LE;
+                if (VAL < m_curr[j]) rel &= ~SOL_REL_GE;
+            }
+
+            if (m_labels[i].kind == SOL_OBSERVE_ENTRY)
+            {
+                auto sum = m_sums.find(m_labels[i].group);
+                if (sum != m_sums.end() && VAL > m_curr[sum->second])
+                {
+                    m_below_sum[i] = false;
+                }
+            }
+        }
+    }
+
+    // Returns the lemmas which held in every snapshot.
+    vector<string> mine() const
+    {
+        vector<string> lemmas;
+        if (m_snapshots < SOL_MIN_SNAPSHOTS) return lemmas;
+
+        for (size_t i = 0; i < m_labels.size(); ++i)
+        {
+            auto const& LABEL = m_labels[i];
+            auto const& RANGE = m_ranges[i];
+            if (LABEL.kind == SOL_OBSERVE_ENTRY)
+            {
+                auto sum = m_sums.find(LABEL.group);
+                if (sum != m_sums.end() && m_below_sum[i])
+                {
+                    auto const& SUM = m_labels[sum->second].expr;
+                    lemmas.push_back(LABEL.expr + " <= " + SUM);
+                }
+                continue;
+            }
+
+            if (RANGE.lo == RANGE.hi)
+            {
+                lemmas.push_back(LABEL.expr + " == " + literal(RANGE.lo));
+                continue;
+            }
+            if (RANGE.lo > 0 && RANGE.lo_hits >= SOL_BOUND_SUPPORT)
+            {
+                lemmas.push_back(LABEL.expr + " >= " + literal(RANGE.lo));
+            }
+            if (RANGE.hi_hits >= SOL_BOUND_SUPPORT)
+            {
+                lemmas.push_back(LABEL.expr + " <= " + literal(RANGE.hi));
+            }
+
+            for (size_t j = i + 1; j < m_labels.size(); ++j)
+            {
+                auto const& OTHER = m_labels[j];
+                if (OTHER.kind == SOL_OBSERVE_ENTRY) continue;
+                if (m_ranges[j].lo == m_ranges[j].hi) continue;
+
+                // Orderings are only proposed between scalars and sums.
+                bool const ORDERED = (LABEL.kind != OTHER.kind);
+                auto const REL = m_rels[i][j];
+                if (REL & SOL_REL_EQ)
+                {
+                    lemmas.push_back(LABEL.expr + " == " + OTHER.expr);
+                }
+                else if (ORDERED && (REL & SOL_REL_LE))
+                {
+                    lemmas.push_back(LABEL.expr + " <= " + OTHER.expr);
+                }
+                else if (ORDERED && (REL & SOL_REL_GE))
+                {
+                    lemmas.push_back(OTHER.expr + " <= " + LABEL.expr);
+                }
+            }
+        }
+        return lemmas;
+    }
+
+    static string literal(sol_raw_uint256_t _val)
+    {
+        return to_string(_val) + "ULL";
+    }
+
+    void write(string const& _path) const
+    {
+        auto const LEMMAS = mine();
+
+        ofstream out(_path);
+        out << "/**" << endl
+            << " * Candidate invariants mined from " << m_snapshots
+            << " snapshot(s)." << endl
+            << " * Each lemma is assumed before a transaction, and is checked"
+            << " after it." << endl
+            << " * Remove any lemma reported as violated." << endl
+            << " */" << endl
+            << endl
+            << "#pragma once" << endl
+            << endl
+            << "#define SOL_LEMMAS (1";
+        for (auto const& lemma : LEMMAS)
+        {
+            out << " \\" << endl << "    && (" << lemma << ")";
+        }
+        out << ")" << endl;
+
+        cerr << "Wrote " << LEMMAS.size() << " lemma(s) from " << m_snapshots
+             << " snapshot(s) to " << _path << endl;
+    }
+};
+
+static SolMiner g_solMiner;
+
+// -------------------------------------------------------------------------- //
+
+void sol_snapshot_begin(void)
+{
+    g_solMiner.begin();
+}
+
+void sol_observe(
+    const char* _expr, uint8_t _kind, uint32_t _group, sol_raw_uint256_t _val
+)
+{
+    g_solMiner.observe({ _expr, _kind, _group }, _val);
+}
+
+void sol_snapshot_end(void)
+{
+    g_solMiner.end();
+}
+
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,515 @@
+/**
+ * Defines a random-walk runtime for the c-model. The model is executed many
+ * times, and each nondeterministic value is drawn from a pseudorandom generator.
+ * Each execution is seeded independently, so that any execution can be replayed
+ * from its seed alone. The executions are split across threads, each with its
+ * own instance of the model.
+ *
+ * Unlike the libFuzzer runtime, no coverage feedback is used, so the runtime
+ * builds with any C++ compiler. If an assertion fails, then the seed of the
+ * failing execution is reported, and its choices are written out as a trace
+ * which may be replayed (or minimized) by icmodel.
+ *
+ * @date 2020
+ */
+
+#include "verify.h"
+#include "verify_hash_concrete.h"
+
+#ifndef MC_USE_STDINT
+#error The random-walk runtime requires MC_USE_STDINT.
+#endif
+
+#include <boost/program_options.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <csetjmp>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace po = boost::program_options;
+
+// -------------------------------------------------------------------------- //
+
+// Expands _state into a stream of well-mixed words (splitmix64).
+static uint64_t sol_split_mix(uint64_t & _state)
+{
+    uint64_t z = (_state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * A small and fast pseudorandom generator (xoshiro256**). The generator is not
+ * thread-safe, so each thread owns its own instances.
+ */
+class SolRandom
+{
+public:
+    explicit SolRandom(uint64_t _seed = 0) { reseed(_seed); }
+
+    // Restarts the stream of words from _seed.
+    void reseed(uint64_t _seed)
+    {
+        for (auto & word : m_state) word = sol_split_mix(_seed);
+    }
+
+    // Returns the next word of the stream.
+    uint64_t next()
+    {
+        uint64_t const RES = rotl(m_state[1] * 5, 7) * 9;
+        uint64_t const T = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= T;
+        m_state[3] = rotl(m_state[3], 45);
+        return RES;
+    }
+
+    // Returns a word in [0, _bound). The bound must be positive.
+    uint64_t below(uint64_t _bound) { return next() % _bound; }
+
+private:
+    uint64_t m_state[4];
+
+    static uint64_t rotl(uint64_t _x, int _k)
+    {
+        return (_x << _k) | (_x >> (64 - _k));
+    }
+};
+
+// -------------------------------------------------------------------------- //
+
+// The ways in which a single execution of the model may end.
+// PASS: all transactions completed.
+// REQUIRE_FAILED: the execution was infeasible.
+// ASSERT_FAILED: the execution violated an assertion.
+enum class SolOutcome { PASS = 1, REQUIRE_FAILED, ASSERT_FAILED };
+
+// The context of a single execution of the model.
+struct SolRun
+{
+    // The source of all choices in this execution.
+    SolRandom rng;
+
+    // The number of transactions started so far.
+    uint32_t transactions;
+
+    // If set, the value of each choice is recorded as input to icmodel.
+    vector<string>* trace;
+
+    // The reason for failure (if any).
+    char const* msg;
+
+    jmp_buf env;
+};
+
+// -------------------------------------------------------------------------- //
+
+static const char g_solHelpCliArg[] = "help";
+static const char g_solHelpCliMsg[] = "display options and settings";
+static const char g_solThreadsCliArg[] = "threads";
+static const char g_solThreadsCliMsg[] = "number of worker threads";
+static const char g_solRunsCliArg[] = "runs";
+static const char g_solRunsCliMsg[] = "number of executions, across all threads";
+static const char g_solDepthCliArg[] = "depth";
+static const char g_solDepthCliMsg[] = "maximum number of transactions per run";
+static const char g_solValuesCliArg[] = "values";
+static const char g_solValuesCliMsg[] = "bound on the small values tried first";
+static const char g_solSeedCliArg[] = "seed";
+static const char g_solSeedCliMsg[] = "seed from which all runs are derived";
+static const char g_solReplayCliArg[] = "replay";
+static const char g_solReplayCliMsg[] = "execute only the run with this seed";
+static const char g_solCexCliArg[] = "cex";
+static const char g_solCexCliMsg[] = "file to write a counterexample trace to";
+static const char g_solZRetCliArg[] = "return-0";
+static const char g_solZRetCliMsg[] = "when true, violations return 0";
+
+static unsigned g_solThreads;
+static uint64_t g_solMaxRuns;
+static uint32_t g_solDepth;
+static uint64_t g_solValues;
+static uint64_t g_solSeed;
+static string g_solCexPath;
+static bool g_solZRet;
+
+// Each worker executes the model through its own context.
+static thread_local SolRun* t_solRun;
+static thread_local SolHashModel t_solHashModel;
+
+static atomic<uint64_t> g_solRuns{0};
+static atomic<uint64_t> g_solReverts{0};
+static atomic<uint64_t> g_solTransactions{0};
+static atomic<bool> g_solFoundCex{false};
+static uint64_t g_solCexSeed;
+
+// Ends the current execution with _outcome.
+static void sol_end_run(SolOutcome _outcome, char const* _msg)
+{
+    t_solRun->msg = _msg;
+    longjmp(t_solRun->env, static_cast<int>(_outcome));
+}
+
+// Records _value as the input to icmodel for the latest choice.
+template <typename T>
+static T sol_record(T _value)
+{
+    if (t_solRun->trace) t_solRun->trace->push_back(to_string(_value));
+    return _value;
+}
+
+// Draws an unsigned word of _bits bits. Most guards compare against small
+// values, or against the extremes of a type, so these are drawn more often
+// than a uniform draw would allow.
+static uint64_t sol_draw_unsigned(unsigned _bits)
+{
+    auto & rng = t_solRun->rng;
+    uint64_t const MAX = SOL_UINT_MAX(_bits);
+    switch (rng.below(8))
+    {
+    case 0: return MAX - rng.below(min(g_solValues, MAX));
+    case 1: return rng.next() & MAX;
+    default: return rng.below(g_solValues) & MAX;
+    }
+}
+
+// Draws a signed word of _bits bits, as in sol_draw_unsigned.
+static int64_t sol_draw_signed(unsigned _bits)
+{
+    auto & rng = t_solRun->rng;
+    int64_t const MAX = (_bits >= 64)
+        ? INT64_MAX : (int64_t(1) << (_bits - 1)) - 1;
+    int64_t const SMALL = static_cast<int64_t>(
+        rng.below(min<uint64_t>(g_solValues, MAX))
+    );
+    switch (rng.below(8))
+    {
+    case 0: return MAX - SMALL;
+    case 1: return -MAX - 1 + SMALL;
+    case 2:
+    {
+        // Sign-extends a uniform draw of _bits bits.
+        unsigned const SHIFT = 64 - min(_bits, 64u);
+        return static_cast<int64_t>(rng.next() << SHIFT) >> SHIFT;
+    }
+    default: return (rng.below(2) == 0) ? SMALL : -SMALL;
+    }
+}
+
+// Executes the model once, with choices drawn from _seed.
+static SolOutcome sol_execute(uint64_t _seed, SolRun & _run)
+{
+    _run.rng.reseed(_seed);
+    _run.transactions = 0;
+    _run.msg = nullptr;
+    if (_run.trace) _run.trace->clear();
+
+    t_solRun = &_run;
+    t_solHashModel.reset();
+
+    int const CODE = setjmp(_run.env);
+    if (CODE == 0)
+    {
+        run_model();
+        return SolOutcome::PASS;
+    }
+    return static_cast<SolOutcome>(CODE);
+}
+
+// Replays the run with _seed, and reports its outcome. If the run violates an
+// assertion, then its trace is written as a counterexample.
+static bool sol_report(uint64_t _seed)
+{
+    vector<string> trace;
+    SolRun run;
+    run.trace = &trace;
+
+    auto const OUTCOME = sol_execute(_seed, run);
+    if (OUTCOME != SolOutcome::ASSERT_FAILED)
+    {
+        cout << "Seed " << _seed << " does not violate an assertion." << endl;
+        return false;
+    }
+
+    string cex;
+    for (auto const& token : trace)
+    {
+        if (!cex.empty()) cex += " ";
+        cex += token;
+    }
+
+    cout << "assert";
+    if (run.msg) cout << ": " << run.msg;
+    cout << endl;
+    cout << "Seed: " << _seed << endl;
+    cout << "Transaction Count: " << run.transactions << endl;
+    cout << "Trace: " << cex << endl;
+
+    ofstream out(g_solCexPath);
+    out << cex << endl;
+    return true;
+}
+
+// -------------------------------------------------------------------------- //
+
+// Executes runs until g_solMaxRuns have started, or an assertion fails. The
+// seed of each run is drawn from a generator owned by _worker.
+static void sol_simulate_worker(unsigned _worker)
+{
+    uint64_t stream = g_solSeed;
+    for (unsigned i = 0; i <= _worker; ++i) sol_split_mix(stream);
+    SolRandom seeds(sol_split_mix(stream));
+
+    SolRun run;
+    run.trace = nullptr;
+    while (!g_solFoundCex && g_solRuns.fetch_add(1) < g_solMaxRuns)
+    {
+        uint64_t const SEED = seeds.next();
+        auto const OUTCOME = sol_execute(SEED, run);
+        g_solTransactions += run.transactions;
+
+        if (OUTCOME == SolOutcome::REQUIRE_FAILED)
+        {
+            ++g_solReverts;
+        }
+        else if (OUTCOME == SolOutcome::ASSERT_FAILED)
+        {
+            if (!g_solFoundCex.exchange(true)) g_solCexSeed = SEED;
+        }
+    }
+}
+
+// Simulates the model with g_solThreads workers.
+static void sol_simulate(void)
+{
+    auto const START = chrono::steady_clock::now();
+
+    vector<thread> workers;
+    for (unsigned i = 0; i < g_solThreads; ++i)
+    {
+        workers.emplace_back(sol_simulate_worker, i);
+    }
+    for (auto & worker : workers) worker.join();
+
+    chrono::duration<double> const ELAPSED = chrono::steady_clock::now() - START;
+    uint64_t const RUNS = min<uint64_t>(g_solRuns, g_solMaxRuns);
+
+    cout << "Seed: " << g_solSeed << endl;
+    cout << "Runs: " << RUNS << " (" << g_solReverts << " reverted)" << endl;
+    cout << "Transactions: " << g_solTransactions << endl;
+    if (ELAPSED.count() > 0)
+    {
+        cout << "Runs/sec: " << uint64_t(RUNS / ELAPSED.count()) << endl;
+    }
+
+    if (g_solFoundCex)
+    {
+        sol_report(g_solCexSeed);
+    }
+    else
+    {
+        cout << "No violations within " << RUNS << " runs." << endl;
+    }
+}
+
+// -------------------------------------------------------------------------- //
+
+void sol_setup(int _argc, const char **_argv)
+{
+    po::options_description desc("Random-Walk Simulator");
+    desc.add_options()
+        (g_solHelpCliArg, g_solHelpCliMsg)
+        (g_solThreadsCliArg,
+            po::value<unsigned>(&g_solThreads)->default_value(
+                max(1u, thread::hardware_concurrency())
+            ),
+            g_solThreadsCliMsg)
+        (g_solRunsCliArg,
+            po::value<uint64_t>(&g_solMaxRuns)->default_value(1000000),
+            g_solRunsCliMsg)
+        (g_solDepthCliArg,
+            po::value<uint32_t>(&g_solDepth)->default_value(8),
+            g_solDepthCliMsg)
+        (g_solValuesCliArg,
+            po::value<uint64_t>(&g_solValues)->default_value(4),
+            g_solValuesCliMsg)
+        (g_solSeedCliArg,
+            po::value<uint64_t>(&g_solSeed)->default_value(1),
+            g_solSeedCliMsg)
+        (g_solReplayCliArg, po::value<uint64_t>(), g_solReplayCliMsg)
+        (g_solCexCliArg,
+            po::value<string>(&g_solCexPath)->default_value("cex.txt"),
+            g_solCexCliMsg)
+        (g_solZRetCliArg, po::bool_switch(&g_solZRet), g_solZRetCliMsg);
+
+    po::variables_map args;
+    po::store(po::parse_command_line(_argc, _argv, desc), args);
+    po::notify(args);
+
+    if (args.count(g_solHelpCliArg))
+    {
+        cout << desc << endl;
+        exit(0);
+    }
+    if (g_solThreads == 0 || g_solValues == 0)
+    {
+        cerr << "Invalid simulation bounds." << endl;
+        exit(2);
+    }
+
+    // The simulation replaces the single execution started by the harness.
+    bool found = false;
+    if (args.count(g_solReplayCliArg))
+    {
+        found = sol_report(args[g_solReplayCliArg].as<uint64_t>());
+    }
+    else
+    {
+        sol_simulate();
+        found = g_solFoundCex;
+    }
+    exit((found && !g_solZRet) ? 1 : 0);
+}
+
+// -------------------------------------------------------------------------- //
+
+uint8_t sol_continue(void)
+{
+    return sol_record<unsigned>(t_solRun->transactions < g_solDepth);
+}
+
+void sol_on_transaction(void)
+{
+    ++t_solRun->transactions;
+}
+
+void sol_on_state(uint64_t) {}
+
+// -------------------------------------------------------------------------- //
+
+void sol_assert(sol_raw_uint8_t _cond, const char* _msg)
+{
+    if (!_cond) sol_end_run(SolOutcome::ASSERT_FAILED, _msg);
+}
+
+void sol_require(sol_raw_uint8_t _cond, const char* _msg)
+{
+    if (!_cond) sol_end_run(SolOutcome::REQUIRE_FAILED, _msg);
+}
+
+void ll_assume(sol_raw_uint8_t _cond)
+{
+    if (!_cond) sol_end_run(SolOutcome::REQUIRE_FAILED, nullptr);
+}
+
+void sol_emit(const char*) {}
+
+void smartace_log(const char*) {}
+
+// -------------------------------------------------------------------------- //
+
+sol_raw_uint8_t sol_crypto(void)
+{
+    return nd_byte(0, nullptr);
+}
+
+sol_raw_uint256_t sol_hash_push(
+    sol_raw_uint256_t _prefix, sol_raw_uint256_t _word, uint8_t _bytes
+)
+{
+    return t_solHashModel.push(_prefix, _word, _bytes);
+}
+
+sol_raw_uint256_t sol_hash_final(uint8_t _fn, sol_raw_uint256_t _prefix)
+{
+    return t_solHashModel.digest(_fn, _prefix);
+}
+
+// -------------------------------------------------------------------------- //
+
+uint8_t nd_byte(int8_t, const char*)
+{
+    return sol_record<unsigned>(sol_draw_unsigned(8));
+}
+
+uint8_t nd_range(int8_t, uint8_t _l, uint8_t _u, const char*)
+{
+    if (_u <= _l) sol_end_run(SolOutcome::REQUIRE_FAILED, nullptr);
+    return sol_record<unsigned>(_l + t_solRun->rng.below(_u - _l));
+}
+
+sol_raw_uint256_t nd_increase(
+    sol_raw_int256_t, sol_raw_uint256_t _curr, uint8_t _strict, const char*
+)
+{
+    // The increase is drawn so that it never overflows.
+    auto & rng = t_solRun->rng;
+    sol_raw_uint256_t const ROOM = SOL_UINT256_MAX - _curr;
+    ll_assume(ROOM >= _strict);
+
+    sol_raw_uint256_t const SPAN = ROOM - _strict;
+    sol_raw_uint256_t delta = rng.below(g_solValues);
+    if (rng.below(8) == 0) delta = rng.next();
+    if (SPAN < SOL_UINT256_MAX) delta %= SPAN + 1;
+    return sol_record(_curr + _strict + delta);
+}
+
+#define SOL_RANDOM_ND(__bits) \
+    sol_raw_int ## __bits ## _t nd_int ## __bits ## _t( \
+        sol_raw_int ## __bits ## _t, const char*) \
+    { \
+        return sol_record<int64_t>( \
+            (sol_raw_int ## __bits ## _t)(sol_draw_signed(__bits))); \
+    } \
+    sol_raw_uint ## __bits ## _t nd_uint ## __bits ## _t( \
+        sol_raw_int ## __bits ## _t, const char*) \
+    { \
+        return sol_record<uint64_t>( \
+            (sol_raw_uint ## __bits ## _t)(sol_draw_unsigned(__bits))); \
+    }
+
+SOL_RANDOM_ND(8)
+SOL_RANDOM_ND(16)
+SOL_RANDOM_ND(24)
+SOL_RANDOM_ND(32)
+SOL_RANDOM_ND(40)
+SOL_RANDOM_ND(48)
+SOL_RANDOM_ND(56)
+SOL_RANDOM_ND(64)
+SOL_RANDOM_ND(72)
+SOL_RANDOM_ND(80)
+SOL_RANDOM_ND(88)
+SOL_RANDOM_ND(96)
+SOL_RANDOM_ND(104)
+SOL_RANDOM_ND(112)
+SOL_RANDOM_ND(120)
+SOL_RANDOM_ND(128)
+SOL_RANDOM_ND(136)
+SOL_RANDOM_ND(144)
+SOL_RANDOM_ND(152)
+SOL_RANDOM_ND(160)
+SOL_RANDOM_ND(168)
+SOL_RANDOM_ND(176)
+SOL_RANDOM_ND(184)
+SOL_RANDOM_ND(192)
+SOL_RANDOM_ND(200)
+SOL_RANDOM_ND(208)
+SOL_RANDOM_ND(216)
+SOL_RANDOM_ND(224)
+SOL_RANDOM_ND(232)
+SOL_RANDOM_ND(240)
+SOL_RANDOM_ND(248)
+SOL_RANDOM_ND(256)
+
+// -------------------------------------------------------------------------- //
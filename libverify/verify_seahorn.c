@@ -19,6 +19,14 @@ sol_raw_uint8_t sol_crypto(void)
     return nd_byte(nd_crypto(), "Select crypto value");
 }
 
+#include "verify_hash_symbolic.h"
+
+extern sol_raw_uint256_t nd_hash(void);
+static sol_raw_uint256_t sol_hash_fresh(void)
+{
+    return nd_hash();
+}
+
 // -------------------------------------------------------------------------- //
 
 void sol_setup(int _argc, const char **_argv) {}
@@ -45,6 +45,7 @@
 #include <libsolidity/modelcheck/analysis/AnalysisStack.h>
 #include <libsolidity/modelcheck/analysis/CallState.h>
 #include <libsolidity/modelcheck/analysis/Primitives.h>
+#include <libsolidity/modelcheck/analysis/TypeNames.h>
 #include <libsolidity/modelcheck/model/ADT.h>
 #include <libsolidity/modelcheck/model/Ether.h>
 #include <libsolidity/modelcheck/model/Function.h>
@@ -82,6 +83,7 @@
 	#include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <string>
 #include <iostream>
 #include <fstream>
@@ -135,6 +137,14 @@ static string const g_strModelLockstepTime = "lockstep-time";
 static string const g_strModelActor = "bundle";
 static string const g_strModelConcrete = "concrete";
 static string const g_strModelFailOnRequire = "fail-on-require";
+static string const g_strModelSplitBundle = "split-bundle";
+static string const g_strModelNarrowInts = "narrow-ints";
+static string const g_strModelOverflowChecks = "overflow-checks";
+static string const g_strModelInlineModifiers = "inline-modifiers";
+static string const g_strModelSharedEnv = "shared-env";
+static string const g_strModelLineMarkers = "line-markers";
+static string const g_strModelSimplify = "simplify";
+static string const g_strModelGlobalState = "global-state";
 static string const g_strCombinedJson = "combined-json";
 static string const g_strCompactJSON = "compact-format";
 static string const g_strContracts = "contracts";
@@ -194,6 +204,14 @@ static string const g_argModelLockstepTime = g_strModelLockstepTime;
 static string const g_argModelActor = g_strModelActor;
 static string const g_argModelConcrete = g_strModelConcrete;
 static string const g_argModelFailOnRequire = g_strModelFailOnRequire;
+static string const g_argModelSplitBundle = g_strModelSplitBundle;
+static string const g_argModelNarrowInts = g_strModelNarrowInts;
+static string const g_argModelOverflowChecks = g_strModelOverflowChecks;
+static string const g_argModelInlineModifiers = g_strModelInlineModifiers;
+static string const g_argModelSharedEnv = g_strModelSharedEnv;
+static string const g_argModelLineMarkers = g_strModelLineMarkers;
+static string const g_argModelSimplify = g_strModelSimplify;
+static string const g_argModelGlobalState = g_strModelGlobalState;
 static string const g_argCombinedJson = g_strCombinedJson;
 static string const g_argCompactJSON = g_strCompactJSON;
 static string const g_argGas = g_strGas;
@@ -644,7 +662,7 @@ void CommandLineInterface::copyDirectory(string const& _src, string const& _dst,
 	if (!_dst.empty()) full_dst /= _dst;
 	if (!fs::exists(full_dst))
 	{
-		fs::create_directory(full_dst);
+		fs::create_directories(full_dst);
 	}
 	else if (!fs::is_directory(full_dst))
 	{
@@ -809,8 +827,8 @@ Allowed options)",
 	smartaceOptions.add_options()
 		(
 			g_argModelMapLen.c_str(),
-			po::value<size_t>()->value_name("k")->default_value(0),
-			"Sets the number of arbitrary clients represented in the model."
+			po::value<string>()->value_name("k")->default_value("0"),
+			"Sets the number of arbitrary clients represented in the model. A range lo..hi generates one model per client count, each in a subdirectory reps_k."
 		)
 		(
 			g_argModelLockstepTime.c_str(),
@@ -824,7 +842,40 @@ Allowed options)",
 		)
 		(g_argModelConcrete.c_str(), "Forces all client to be concrete. This corresponds to a bounded model.")
 		(g_argModelMapSum.c_str(), "Auto-instruments all maps with sum variables.")
-		(g_argModelFailOnRequire.c_str(), "Escalates requirement failures to assertion failures.");
+		(g_argModelFailOnRequire.c_str(), "Escalates requirement failures to assertion failures.")
+		(
+			g_argModelSplitBundle.c_str(),
+			"Emits one model per top-level contract in the bundle. Each model is written to a subdirectory named after its contract."
+		)
+		(
+			g_argModelNarrowInts.c_str(),
+			"Models unsigned state variables with fewer bits, when all values they store provably fit."
+		)
+		(
+			g_argModelOverflowChecks.c_str(),
+			po::value<string>()->value_name("none,all,unproven")->default_value("none"),
+			"Asserts that integer addition, subtraction and multiplication never overflow. With unproven, checks are elided when overflow is provably impossible."
+		)
+		(
+			g_argModelInlineModifiers.c_str(),
+			"Forces each link of a modifier chain to be inlined into its method, even in unoptimized builds. Modifiers with more than one placeholder are not inlined."
+		)
+		(
+			g_argModelSharedEnv.c_str(),
+			"Passes the block number, timestamp and origin of each transaction through a single shared struct, rather than as separate arguments to every call."
+		)
+		(
+			g_argModelLineMarkers.c_str(),
+			"Annotates cmodel.c with #line directives, so that debuggers, profilers and coverage reports refer to lines of the Solidity source."
+		)
+		(
+			g_argModelSimplify.c_str(),
+			"Simplifies cmodel.c before it is printed. Constant expressions are folded, and branches, loops and statements which are never reached are removed."
+		)
+		(
+			g_argModelGlobalState.c_str(),
+			"Hoists each state variable out of its contract, and into a global of cmodel.c. This lets verifiers such as Seahorn reason about each variable as a separate object. Each state variable may be instantiated at most once."
+		);
 	desc.add(smartaceOptions);
 
 	po::options_description allOptions = desc;
@@ -1273,6 +1324,36 @@ void CommandLineInterface::handleAst(string const& _argStr)
 	}
 }
 
+namespace
+{
+
+/// Parses a client count of the form k or lo..hi into [@a _lo, @a _hi].
+/// @returns false if @a _arg is malformed.
+bool parseClientRange(string const& _arg, size_t& _lo, size_t& _hi)
+{
+	try
+	{
+		auto const SEP = _arg.find("..");
+		size_t pos;
+		_lo = stoul(_arg.substr(0, SEP), &pos);
+		if (pos != _arg.substr(0, SEP).size()) return false;
+		if (SEP == string::npos)
+		{
+			_hi = _lo;
+			return true;
+		}
+		string const HI_STR = _arg.substr(SEP + 2);
+		_hi = stoul(HI_STR, &pos);
+		return (pos == HI_STR.size() && _lo <= _hi);
+	}
+	catch (logic_error const&)
+	{
+		return false;
+	}
+}
+
+}
+
 void CommandLineInterface::handleCModel()
 {
 	// Generates an AST for each Solidity source unit.
@@ -1331,14 +1412,6 @@ void CommandLineInterface::handleCModel()
 		}
 	}
 
-	// Runs full analysis stack.
-	size_t client_count = m_args[g_argModelMapLen].as<size_t>();
-	bool concrete_addrs = (m_args.count(g_argModelConcrete) > 0);
-	bool escalate_reqs = (m_args.count(g_argModelFailOnRequire) > 0);
-	auto analysis_stack = make_shared<modelcheck::AnalysisStack>(
-		major_actors, asts, client_count, concrete_addrs, escalate_reqs
-	);
-
 	// Aggregates primitive types.
 	// TODO(scottwe): use flat model and move to model.
 	modelcheck::PrimitiveTypeGenerator primitive_set;
@@ -1346,40 +1419,136 @@ void CommandLineInterface::handleCModel()
 	{
 		primitive_set.record(*ast);
 	}
-	analysis_stack->environment()->register_primitives(primitive_set);
+
+	// Resolves the range of client counts to model.
+	size_t min_clients, max_clients;
+	if (!parseClientRange(m_args[g_argModelMapLen].as<string>(), min_clients, max_clients))
+	{
+		m_error = true;
+		serr() << "Invalid client count: " << m_args[g_argModelMapLen].as<string>() << endl;
+		return;
+	}
+	bool const SWEEP = (min_clients != max_clients);
+
+	// Groups the actors into either a single model, or one model per actor.
+	vector<pair<string, vector<ContractDefinition const*>>> bundles;
+	if (m_args.count(g_argModelSplitBundle))
+	{
+		for (auto const* actor : major_actors)
+		{
+			bundles.emplace_back(actor->name(), vector<ContractDefinition const*>{ actor });
+		}
+	}
+	else
+	{
+		bundles.emplace_back("", major_actors);
+	}
+
+	// Generates each model. The client-independent analyses are only run once
+	// per bundle, and are then shared across all client counts.
+	bool concrete_addrs = (m_args.count(g_argModelConcrete) > 0);
+	bool escalate_reqs = (m_args.count(g_argModelFailOnRequire) > 0);
+	bool narrow_ints = (m_args.count(g_argModelNarrowInts) > 0);
+	bool shared_env = (m_args.count(g_argModelSharedEnv) > 0);
+	bool global_state = (m_args.count(g_argModelGlobalState) > 0);
+
+	auto overflow_checks = modelcheck::OverflowChecks::NONE;
+	string const OVERFLOW_MODE = m_args[g_argModelOverflowChecks].as<string>();
+	if (OVERFLOW_MODE == "all")
+	{
+		overflow_checks = modelcheck::OverflowChecks::ALL;
+	}
+	else if (OVERFLOW_MODE == "unproven")
+	{
+		overflow_checks = modelcheck::OverflowChecks::UNPROVEN;
+	}
+	else if (OVERFLOW_MODE != "none")
+	{
+		m_error = true;
+		serr() << "Invalid overflow check mode: " << OVERFLOW_MODE << endl;
+		return;
+	}
+
+	for (auto const& bundle : bundles)
+	{
+		auto base_stack = make_shared<modelcheck::AnalysisStack>(
+			bundle.second,
+			asts,
+			min_clients,
+			concrete_addrs,
+			escalate_reqs,
+			narrow_ints,
+			overflow_checks,
+			shared_env,
+			global_state
+		);
+
+		for (size_t clients = min_clients; clients <= max_clients; ++clients)
+		{
+			auto analysis_stack = base_stack;
+			if (clients != min_clients)
+			{
+				analysis_stack = make_shared<modelcheck::AnalysisStack>(
+					*base_stack, clients
+				);
+			}
+
+			boost::filesystem::path subdir(bundle.first);
+			if (SWEEP) subdir /= "reps_" + to_string(clients);
+
+			handleCModelProject(analysis_stack, primitive_set, subdir.string());
+			if (m_error) return;
+		}
+	}
+}
+
+void CommandLineInterface::handleCModelProject(
+	shared_ptr<modelcheck::AnalysisStack> _stack,
+	modelcheck::PrimitiveTypeGenerator _primitives,
+	string const& _subdir
+)
+{
+	_stack->environment()->register_primitives(_primitives);
+	_stack->types()->register_primitives(_primitives);
 
 	// Sets up the non-determinism registry.
-	auto nondet_reg = make_shared<modelcheck::NondetSourceRegistry>(analysis_stack);
+	auto nondet_reg = make_shared<modelcheck::NondetSourceRegistry>(_stack);
 
 	// Outputs model.
 	if (m_args.count(g_argOutputDir))
 	{
 		namespace fs = boost::filesystem;
 
-		copyDirectory((m_install_dir / "share/solc/project").string(), "", true);
-		copyDirectory((m_install_dir / "include/solc/libverify").string(), "libverify", true);
-		copyDirectory((m_install_dir / "include/solc/yaml").string(), "yaml", true);
+		fs::path root(_subdir);
+		copyDirectory((m_install_dir / "share/solc/project").string(), root.string(), true);
+		copyDirectory((m_install_dir / "include/solc/libverify").string(), (root / "libverify").string(), true);
+		copyDirectory((m_install_dir / "include/solc/yaml").string(), (root / "yaml").string(), true);
+
+		stringstream runtime_data;
+		handleCModelRuntime(runtime_data);
+		createFile((root / "cmake/SmartAceRuntime.cmake").string(), runtime_data.str());
 
 		stringstream cmodel_cpp_data, cmodel_h_data, primitive_data, harness_data;
 		handleCModelHarness(harness_data);
-		handleCModelHeaders(analysis_stack, nondet_reg, cmodel_h_data);
-		handleCModelBody(analysis_stack, nondet_reg, cmodel_cpp_data);
-		handleCModelPrimitives(primitive_set, *nondet_reg, primitive_data);
-		createFile("primitive.h", primitive_data.str());
-		createFile("cmodel.h", cmodel_h_data.str());
-		createFile("cmodel.c", cmodel_cpp_data.str());
-		createFile("harness.c", harness_data.str());
+		handleCModelHeaders(_stack, nondet_reg, cmodel_h_data);
+		handleCModelBody(_stack, nondet_reg, cmodel_cpp_data);
+		handleCModelPrimitives(_stack, _primitives, *nondet_reg, primitive_data);
+		createFile((root / "primitive.h").string(), primitive_data.str());
+		createFile((root / "cmodel.h").string(), cmodel_h_data.str());
+		createFile((root / "cmodel.c").string(), cmodel_cpp_data.str());
+		createFile((root / "harness.c").string(), harness_data.str());
 	}
 	else
 	{
-		sout() << "======= harness.c(pp) =======" << endl;
+		string const PREFIX = (_subdir.empty() ? "" : _subdir + "/");
+		sout() << "======= " << PREFIX << "harness.c(pp) =======" << endl;
 		handleCModelHarness(sout());
-		sout() << endl << endl << "======= cmodel.h =======" << endl;
-		handleCModelHeaders(analysis_stack, nondet_reg, sout());
-		sout() << endl << endl << "======= cmodel.c(pp) =======" << endl;
-		handleCModelBody(analysis_stack, nondet_reg, sout());
-		sout() << "====== primitive.h =====" << endl;
-		handleCModelPrimitives(primitive_set, *nondet_reg, sout());
+		sout() << endl << endl << "======= " << PREFIX << "cmodel.h =======" << endl;
+		handleCModelHeaders(_stack, nondet_reg, sout());
+		sout() << endl << endl << "======= " << PREFIX << "cmodel.c(pp) =======" << endl;
+		handleCModelBody(_stack, nondet_reg, sout());
+		sout() << "====== " << PREFIX << "primitive.h =====" << endl;
+		handleCModelPrimitives(_stack, _primitives, *nondet_reg, sout());
 		sout() << endl;
 	}
 }
@@ -1394,14 +1563,31 @@ void CommandLineInterface::handleCModelHarness(ostream& _os)
 		<< "}";
 }
 
+void CommandLineInterface::handleCModelRuntime(ostream& _os)
+{
+	string const RUNTIME_DIR = (m_install_dir / "lib/solc").generic_string();
+	_os << "# Locates the runtime libraries installed alongside solc." << endl
+	    << "set(" << endl
+	    << "    MC_RUNTIME_DIR" << endl
+	    << "    \"" << RUNTIME_DIR << "\"" << endl
+	    << "    CACHE PATH" << endl
+	    << "    \"The path to the prebuilt libverify runtimes.\"" << endl
+	    << ")" << endl;
+}
+
 void CommandLineInterface::handleCModelPrimitives(
+	shared_ptr<modelcheck::AnalysisStack const> _stack,
 	modelcheck::PrimitiveTypeGenerator _gen,
 	modelcheck::NondetSourceRegistry _nd_reg,
 	ostream& _os
 )
 {
-	_os << "#pragma once" << endl
-	    << "#include \"libverify/verify.h\"" << endl;
+	_os << "#pragma once" << endl;
+	if (_stack->overflow_checks() != modelcheck::OverflowChecks::NONE)
+	{
+		_os << "#define MC_OVERFLOW_CHECKS" << endl;
+	}
+	_os << "#include \"libverify/verify.h\"" << endl;
 	_nd_reg.print(_os);
 	_gen.print(_os);
 }
@@ -1417,6 +1603,7 @@ void CommandLineInterface::handleCModelHeaders(
 	using dev::solidity::modelcheck::FunctionConverter;
 
 	bool sum_maps = (m_args.count(g_argModelMapSum) > 0);
+	bool inline_mods = (m_args.count(g_argModelInlineModifiers) > 0);
 	size_t address_ct = _stack->addresses()->size();
 
 	_os << "#pragma once" << endl
@@ -1428,7 +1615,12 @@ void CommandLineInterface::handleCModelHeaders(
 	ADTConverter(_stack, sum_maps, address_ct, true).print(_os);
 
 	FunctionConverter(
-		_stack, sum_maps, address_ct, FunctionConverter::View::EXT, true
+		_stack,
+		sum_maps,
+		address_ct,
+		FunctionConverter::View::EXT,
+		true,
+		inline_mods
 	).print(_os);
 }
 
@@ -1444,29 +1636,64 @@ void CommandLineInterface::handleCModelBody(
 	using dev::solidity::modelcheck::MainFunctionGenerator;
 
 	bool sum_maps = (m_args.count(g_argModelMapSum) > 0);
+	bool inline_mods = (m_args.count(g_argModelInlineModifiers) > 0);
+	bool line_markers = (m_args.count(g_argModelLineMarkers) > 0);
+	bool simplify = (m_args.count(g_argModelSimplify) > 0);
 	size_t address_ct = _stack->addresses()->size();
 	bool lockstep_time = m_args[g_argModelLockstepTime].as<bool>();
 
-	_os << "#include \"cmodel.h\"" << endl;
+	stringstream body;
+	body << "#include \"cmodel.h\"" << endl
+	     << "#ifdef MC_USE_INVARIANTS" << endl
+	     << "#include \"invariants.h\"" << endl
+	     << "#endif" << endl
+	     << "#ifdef MC_USE_SEA_LEMMAS" << endl
+	     << "#include \"sea_lemmas.h\"" << endl
+	     << "#endif" << endl;
 	for (auto lit : _stack->addresses()->literals())
 	{
 		auto const NAME = modelcheck::AbstractAddressDomain::literal_name(lit);
-		_os << modelcheck::CVarDecl("sol_raw_uint160_t", NAME);
+		body << modelcheck::CVarDecl("SOL_GLOBAL sol_raw_uint160_t", NAME);
 	}
 
-	EtherMethodGenerator(_stack, _nd_reg).print(_os, false);
+	EtherMethodGenerator(_stack, _nd_reg).print(body, false);
 
-	ADTConverter(_stack, sum_maps, address_ct, false).print(_os);
+	ADTConverter(_stack, sum_maps, address_ct, false).print(body);
 
 	FunctionConverter(
-		_stack, sum_maps, address_ct, FunctionConverter::View::INT, true
-	).print(_os);
+		_stack,
+		sum_maps,
+		address_ct,
+		FunctionConverter::View::INT,
+		true,
+		inline_mods
+	).print(body);
 
 	FunctionConverter(
-		_stack, sum_maps, address_ct, FunctionConverter::View::FULL, false
-	).print(_os);
+		_stack,
+		sum_maps,
+		address_ct,
+		FunctionConverter::View::FULL,
+		false,
+		inline_mods,
+		line_markers,
+		simplify
+	).print(body);
+
+	// The harness has no Solidity source, so its lines are restored. The marker
+	// begins on a new line, and so the harness starts two lines later.
+	if (line_markers)
+	{
+		auto const DATA = body.str();
+		size_t const LINES = count(DATA.begin(), DATA.end(), '\n');
+		body << modelcheck::CLineMarker("cmodel.c", LINES + 3);
+	}
+
+	MainFunctionGenerator(
+		lockstep_time, sum_maps, _stack, _nd_reg, simplify
+	).print(body);
 
-	MainFunctionGenerator(lockstep_time, _stack, _nd_reg).print(_os);
+	_os << body.str();
 }
 
 bool CommandLineInterface::actOnInput()
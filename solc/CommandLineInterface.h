@@ -72,8 +72,19 @@ private:
 	void handleCombinedJSON();
 	void handleAst(std::string const& _argStr);
 	void handleCModel();
+	/// Emits the SmartACE model described by @a _stack. If @a _subdir is
+	/// non-empty, the model is written to (or labeled by) the given subdirectory
+	/// of the output directory.
+	void handleCModelProject(
+		std::shared_ptr<modelcheck::AnalysisStack> _stack,
+		modelcheck::PrimitiveTypeGenerator _primitives,
+		std::string const& _subdir
+	);
 	void handleCModelHarness(std::ostream& _os);
+	/// Points the project at the prebuilt runtimes installed with this solc.
+	void handleCModelRuntime(std::ostream& _os);
 	void handleCModelPrimitives(
+		std::shared_ptr<modelcheck::AnalysisStack const> _stack,
 		modelcheck::PrimitiveTypeGenerator _gen,
 		modelcheck::NondetSourceRegistry _nd_reg,
 		std::ostream& _os
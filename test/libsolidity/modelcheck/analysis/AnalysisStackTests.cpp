@@ -162,6 +162,90 @@ BOOST_AUTO_TEST_CASE(params)
     BOOST_CHECK(stack_wparam->environment()->escalate_requires());
 }
 
+BOOST_AUTO_TEST_CASE(client_reparameterization)
+{
+    char const* text = R"(
+        contract X {
+            function f() public {}
+        }
+    )";
+
+    const auto& unit = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(unit, "X");
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &unit });
+
+    auto base = make_shared<AnalysisStack>(model, full, 0, false, false);
+    auto swept = make_shared<AnalysisStack>(*base, 5);
+    auto fresh = make_shared<AnalysisStack>(model, full, 5, false, false);
+
+    BOOST_CHECK_EQUAL(base->addresses()->client_count(), 0);
+    BOOST_CHECK_EQUAL(swept->addresses()->client_count(), 5);
+    BOOST_CHECK_EQUAL(swept->addresses()->size(), fresh->addresses()->size());
+    BOOST_CHECK_EQUAL(
+        swept->addresses()->max_interference(),
+        fresh->addresses()->max_interference()
+    );
+
+    BOOST_CHECK_EQUAL(swept->model().get(), base->model().get());
+    BOOST_CHECK_EQUAL(swept->calls().get(), base->calls().get());
+    BOOST_CHECK_EQUAL(swept->types().get(), base->types().get());
+    BOOST_CHECK_NE(swept->addresses().get(), base->addresses().get());
+}
+
+BOOST_AUTO_TEST_CASE(global_state)
+{
+    char const* text = R"(
+        contract X {
+            int a; int constant b = 5;
+        }
+        contract Y is X {
+            X x; int c;
+            constructor() public { x = new X(); }
+        }
+        contract Z is X {
+            int a;
+        }
+    )";
+
+    const auto& unit = *parseAndAnalyse(text);
+    auto ctrt_x = retrieveContractByName(unit, "X");
+    auto ctrt_y = retrieveContractByName(unit, "Y");
+    auto ctrt_z = retrieveContractByName(unit, "Z");
+    auto const NONE = OverflowChecks::NONE;
+
+    vector<SourceUnit const*> full({ &unit });
+    vector<ContractDefinition const*> model_x({ ctrt_x });
+    vector<ContractDefinition const*> model_y({ ctrt_y });
+    vector<ContractDefinition const*> model_z({ ctrt_z });
+
+    AnalysisStack flat(model_x, full, 0, false, false, false, NONE, false);
+    AnalysisStack hoisted(
+        model_x, full, 0, false, false, false, NONE, false, true
+    );
+
+    auto const& X_VARS = ctrt_x->stateVariables();
+    auto const& Y_VARS = ctrt_y->stateVariables();
+    BOOST_CHECK(!flat.hoists(*X_VARS[0]));
+    BOOST_CHECK(hoisted.hoists(*X_VARS[0]));
+    BOOST_CHECK(!hoisted.hoists(*X_VARS[1]));
+    BOOST_CHECK(!hoisted.hoists(*Y_VARS[0]));
+    BOOST_CHECK(hoisted.hoists(*Y_VARS[1]));
+
+    // Y::x and Y both instantiate X::a.
+    BOOST_CHECK_THROW(
+        AnalysisStack(model_y, full, 0, false, false, false, NONE, false, true),
+        runtime_error
+    );
+
+    // Z::a shadows X::a.
+    BOOST_CHECK_THROW(
+        AnalysisStack(model_z, full, 0, false, false, false, NONE, false, true),
+        runtime_error
+    );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // -------------------------------------------------------------------------- //
@@ -0,0 +1,132 @@
+/**
+ * Tests for libsolidity/modelcheck/analysis/BitWidth.
+ *
+ * @date 2020
+ */
+
+#include <libsolidity/modelcheck/analysis/BitWidth.h>
+
+#include <boost/test/unit_test.hpp>
+#include <test/libsolidity/AnalysisFramework.h>
+
+#include <libsolidity/modelcheck/analysis/AllocationSites.h>
+#include <libsolidity/modelcheck/analysis/Inheritance.h>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+namespace test
+{
+
+// -------------------------------------------------------------------------- //
+
+BOOST_FIXTURE_TEST_SUITE(
+    Analysis_BitWidthTests, ::dev::solidity::test::AnalysisFramework
+)
+
+BOOST_AUTO_TEST_CASE(literal_writes)
+{
+    char const* text = R"(
+        contract A {
+            uint256 constant C = 1000;
+            uint256 a;
+            uint256 b = 5;
+            uint256 c;
+            uint256 d;
+            uint8 e;
+            int256 f;
+            function g(bool _x) public {
+                a = 1;
+                a = 255;
+                c = _x ? 7 : 300;
+                d = C;
+                e = 3;
+                f = 2;
+            }
+        }
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto const* ctrt = retrieveContractByName(unit, "A");
+    auto const& vars = ctrt->stateVariables();
+
+    vector<ContractDefinition const*> model({ ctrt });
+    AllocationGraph graph(model);
+    FlatModel flat_model(model, graph);
+
+    auto const& narrowed = BitWidthAnalyzer(flat_model).narrowed();
+    BOOST_CHECK_EQUAL(narrowed.size(), 4);
+    BOOST_CHECK_EQUAL(narrowed.at(vars[1]), 8);
+    BOOST_CHECK_EQUAL(narrowed.at(vars[2]), 8);
+    BOOST_CHECK_EQUAL(narrowed.at(vars[3]), 16);
+    BOOST_CHECK_EQUAL(narrowed.at(vars[4]), 16);
+}
+
+BOOST_AUTO_TEST_CASE(unbounded_writes)
+{
+    char const* text = R"(
+        contract A {
+            uint256 a;
+            uint256 b;
+            uint256 c;
+            uint256 d;
+            uint256 e;
+            function f(uint256 _v) public {
+                a++;
+                b += 1;
+                c = _v;
+                (d, e) = (1, 2);
+            }
+        }
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto const* ctrt = retrieveContractByName(unit, "A");
+
+    vector<ContractDefinition const*> model({ ctrt });
+    AllocationGraph graph(model);
+    FlatModel flat_model(model, graph);
+
+    BOOST_CHECK(BitWidthAnalyzer(flat_model).narrowed().empty());
+}
+
+BOOST_AUTO_TEST_CASE(inherited_writes)
+{
+    char const* text = R"(
+        contract A {
+            uint256 a;
+            uint256 b;
+            function f() public { a = 1; b = 1; }
+        }
+        contract B is A {
+            function g(uint256 _v) public { b = _v; }
+        }
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto const* ctrt_a = retrieveContractByName(unit, "A");
+    auto const* ctrt_b = retrieveContractByName(unit, "B");
+    auto const& vars = ctrt_a->stateVariables();
+
+    vector<ContractDefinition const*> model({ ctrt_b });
+    AllocationGraph graph(model);
+    FlatModel flat_model(model, graph);
+
+    auto const& narrowed = BitWidthAnalyzer(flat_model).narrowed();
+    BOOST_CHECK_EQUAL(narrowed.size(), 1);
+    BOOST_CHECK_EQUAL(narrowed.at(vars[0]), 8);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
+}
@@ -99,7 +99,7 @@ BOOST_AUTO_TEST_CASE(basic_rv_analysis)
     ContractRvAnalyzer h_res(*ctrt, graph, *func_h);
     auto key = make_pair(ctrt, func_f);
     BOOST_CHECK_EQUAL(h_res.internals().size(), 1);
-    BOOST_CHECK(h_res.externals().find(child_xx) != h_res.externals().end());
+    BOOST_CHECK(h_res.internals().find(child_xx) != h_res.internals().end());
     BOOST_CHECK_EQUAL(h_res.externals().size(), 1);
     BOOST_CHECK(h_res.externals().find(child_x) != h_res.externals().end());
     BOOST_CHECK_EQUAL(h_res.dependencies().size(), 1);
@@ -209,7 +209,7 @@ BOOST_AUTO_TEST_CASE(external_call)
     auto ext = retrieveContractByName(ast, "Ext");
 
     auto func_f = ctrt->definedFunctions()[1];
-    auto extcall = ext->definedFunctions()[1];
+    auto extcall = ext->definedFunctions()[0];
 
     BOOST_CHECK_EQUAL(func_f->name(), "f");
     BOOST_CHECK_EQUAL(extcall->name(), "f");
@@ -274,6 +274,36 @@ BOOST_AUTO_TEST_CASE(uint_detection)
     }
 }
 
+// Targeted test for fixed-size byte arrays, which are modeled as uints.
+BOOST_AUTO_TEST_CASE(bytes_detection)
+{
+    char const* text = R"(
+        contract A {
+            bytes4 v1;
+            mapping(bool => bytes4) v2;
+            mapping(bytes4 => bool) v3;
+            function f1() public { bytes4 v; }
+            function f2(bytes4 v) public { }
+            function f3() public returns (bytes4) { bytes4 v; return v; }
+            modifier m1(bytes4 v) { _; }
+        }
+    )";
+
+    auto const& ast = *parseAndAnalyse(text);
+    auto const& ctrt = *retrieveContractByName(ast, "A");
+
+    for (auto node : ctrt.subNodes())
+    {
+        PrimitiveTypeGenerator gen;
+        gen.record(*node);
+        for (unsigned char i = 1; i <= 32; ++i)
+        {
+            BOOST_CHECK_EQUAL(gen.found_uint(i), i == 1 || i == 4 || i == 8);
+            BOOST_CHECK(!gen.found_int(i));
+        }
+    }
+}
+
 // Targeted test for fixed typed values.
 BOOST_AUTO_TEST_CASE(fixed_detection)
 {
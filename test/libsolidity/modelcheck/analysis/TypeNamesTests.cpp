@@ -439,6 +439,43 @@ BOOST_AUTO_TEST_CASE(name_escape)
     BOOST_CHECK_EQUAL(converter.get_name(mapv), "Map_1");
 }
 
+// Ensures that narrowing changes the CType and initializer of a variable, but
+// leaves all other variables unchanged.
+BOOST_AUTO_TEST_CASE(narrowing)
+{
+    char const* text = R"(
+        contract A {
+            uint256 a;
+            uint256 b;
+            int256 c;
+        }
+    )";
+
+    auto const& ast = *parseAndAnalyse(text);
+    auto const& ctrt = *retrieveContractByName(ast, "A");
+    auto const& a = *ctrt.stateVariables()[0];
+    auto const& b = *ctrt.stateVariables()[1];
+    auto const& c = *ctrt.stateVariables()[2];
+
+    TypeAnalyzer converter;
+    converter.record(ast);
+    converter.narrow(a, 16);
+
+    BOOST_CHECK(converter.is_narrowed(a));
+    BOOST_CHECK(!converter.is_narrowed(b));
+    BOOST_CHECK_EQUAL(converter.get_type(a), "sol_uint16_t");
+    BOOST_CHECK_EQUAL(converter.get_type(b), "sol_uint256_t");
+
+    ostringstream init_a, init_b;
+    init_a << *converter.get_init_val(a);
+    init_b << *converter.get_init_val(b);
+    BOOST_CHECK_EQUAL(init_a.str(), "Init_sol_uint16_t(0)");
+    BOOST_CHECK_EQUAL(init_b.str(), "Init_sol_uint256_t(0)");
+
+    BOOST_CHECK_THROW(converter.narrow(b, 12), runtime_error);
+    BOOST_CHECK_THROW(converter.narrow(c, 8), runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
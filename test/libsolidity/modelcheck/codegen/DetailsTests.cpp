@@ -98,6 +98,112 @@ BOOST_AUTO_TEST_CASE(var_decl_types)
     BOOST_CHECK_EQUAL(set_val_actual.str(), "type name=42;");
 }
 
+// Tests that line markers are printed on their own lines, before statements.
+BOOST_AUTO_TEST_CASE(line_markers)
+{
+    ostringstream marker_actual;
+    marker_actual << CLineMarker("a\\\"b.sol", 12);
+    BOOST_CHECK_EQUAL(marker_actual.str(), "\n#line 12 \"a\\\\\\\"b.sol\"\n");
+
+    auto stmt = make_shared<CReturn>(make_shared<CIntLiteral>(5));
+    stmt->mark(make_shared<CLineMarker>("a.sol", 3));
+
+    ostringstream stmt_actual;
+    stmt_actual << CBlock(CBlockList{stmt});
+    BOOST_CHECK_EQUAL(stmt_actual.str(), "{\n#line 3 \"a.sol\"\nreturn 5;}");
+}
+
+// Tests that constant subexpressions are folded, and that all other
+// subexpressions are left unchanged.
+BOOST_AUTO_TEST_CASE(constant_folding)
+{
+    auto x = make_shared<CIdentifier>("x", false);
+    auto two = make_shared<CIntLiteral>(2);
+    auto three = make_shared<CIntLiteral>(3);
+    auto zero = make_shared<CIntLiteral>(0);
+
+    auto sum = make_shared<CBinaryOp>(two, "+", three);
+    auto prod = make_shared<CBinaryOp>(sum, "*", three);
+    auto mixed = make_shared<CBinaryOp>(x, "<", prod);
+    auto cond = make_shared<CCond>(
+        make_shared<CUnaryOp>("!", zero, true), mixed, x
+    );
+    auto call = make_shared<CFuncCall>("f", CArgList{cond, x});
+
+    ostringstream actual;
+    actual << *simplify(call);
+    BOOST_CHECK_EQUAL(actual.str(), "f((x)<(15),x)");
+
+    BOOST_CHECK(x->simplify() == nullptr);
+    BOOST_CHECK(make_shared<CBinaryOp>(x, "+", two)->simplify() == nullptr);
+    BOOST_CHECK(make_shared<CBinaryOp>(two, "/", zero)->simplify() == nullptr);
+
+    auto short_circuit = make_shared<CBinaryOp>(zero, "&&", call);
+    ostringstream short_circuit_actual;
+    short_circuit_actual << *simplify(short_circuit);
+    BOOST_CHECK_EQUAL(short_circuit_actual.str(), "0");
+}
+
+// Tests that unreachable branches and statements are pruned.
+BOOST_AUTO_TEST_CASE(dead_code_pruning)
+{
+    auto x = make_shared<CIdentifier>("x", false);
+    auto y = make_shared<CIdentifier>("y", false);
+    auto zero = make_shared<CIntLiteral>(0);
+    auto one = make_shared<CIntLiteral>(1);
+
+    CBlockList stmts;
+    stmts.push_back(make_shared<CIf>(zero, x->assign(one)->stmt()));
+    stmts.push_back(make_shared<CIf>(
+        make_shared<CBinaryOp>(one, "==", one),
+        make_shared<CBlock>(CBlockList{x->assign(zero)->stmt()}),
+        y->assign(zero)->stmt()
+    ));
+    stmts.push_back(make_shared<CWhileLoop>(x->assign(one)->stmt(), zero, false));
+    stmts.push_back(make_shared<CExprStmt>(x));
+    stmts.push_back(make_shared<CReturn>(y));
+    stmts.push_back(y->assign(one)->stmt());
+
+    ostringstream actual;
+    actual << *simplify(make_shared<CBlock>(move(stmts)));
+    BOOST_CHECK_EQUAL(actual.str(), "{(x)=(0);return y;}");
+}
+
+// Tests that blocks with declarations are kept, and that an else branch is
+// never captured by a nested if statement.
+BOOST_AUTO_TEST_CASE(scope_preservation)
+{
+    auto x = make_shared<CIdentifier>("x", false);
+    auto y = make_shared<CIdentifier>("y", false);
+    auto one = make_shared<CIntLiteral>(1);
+
+    auto inner = make_shared<CIf>(one, make_shared<CIf>(y, x->assign(one)->stmt()));
+    CStmtPtr outer = make_shared<CIf>(x, inner, y->assign(one)->stmt());
+    CStmtPtr decl = make_shared<CVarDecl>("int", "z", false, one);
+    CStmtPtr scope = make_shared<CBlock>(CBlockList{decl, outer});
+
+    ostringstream actual;
+    actual << *simplify(make_shared<CBlock>(CBlockList{scope}));
+    BOOST_CHECK_EQUAL(
+        actual.str(), "{{int z=1;if(x){if(y)(x)=(1);}else (y)=(1);}}"
+    );
+}
+
+// Tests that a temporary returned immediately after declaration is forwarded.
+BOOST_AUTO_TEST_CASE(temporary_forwarding)
+{
+    auto x = make_shared<CIdentifier>("x", false);
+    auto init = make_shared<CFuncCall>("f", CArgList{x});
+    auto tmp = make_shared<CVarDecl>("int", "tmp", false, init);
+
+    CBlockList stmts{CStmtPtr(tmp), make_shared<CReturn>(tmp->id())};
+    CFuncDef def(make_shared<CVarDecl>("int", "g"), CParams{}, make_shared<CBlock>(move(stmts)));
+
+    ostringstream actual;
+    actual << def.simplify();
+    BOOST_CHECK_EQUAL(actual.str(), "int g(void){return f(x);}");
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 
 }
@@ -219,6 +219,46 @@ BOOST_AUTO_TEST_CASE(constants)
     BOOST_CHECK_EQUAL(actual.str(), expect.str());
 }
 
+BOOST_AUTO_TEST_CASE(global_state)
+{
+    char const* text = R"(
+        contract X {
+            int c;
+        }
+        contract Test {
+            X x; int a; int constant b = 5;
+            constructor() public { x = new X(); }
+        }
+    )";
+
+    auto const &unit = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(unit, "Test");
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &unit });
+    auto stack = make_shared<AnalysisStack>(
+        model, full, 0, false, false, false, OverflowChecks::NONE, false, true
+    );
+
+    ostringstream actual, expect;
+    ADTConverter(stack, false, 1, false).print(actual);
+    expect << "struct X"
+           << "{"
+           << "sol_address_t model_address;"
+           << "sol_uint256_t model_balance;"
+           << "};";
+    expect << "SOL_GLOBAL sol_int256_t g_X_user_c;";
+    expect << "struct Test"
+           << "{"
+           << "sol_address_t model_address;"
+           << "sol_uint256_t model_balance;"
+           << "struct X user_x;"
+           << "};";
+    expect << "SOL_GLOBAL sol_int256_t g_Test_user_a;";
+
+    BOOST_CHECK_EQUAL(actual.str(), expect.str());
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 
 // -------------------------------------------------------------------------- //
@@ -1077,6 +1077,31 @@ BOOST_AUTO_TEST_CASE(modifier_args)
     BOOST_CHECK_EQUAL(actual.str(), expected.str());
 }
 
+BOOST_AUTO_TEST_CASE(modifier_linearity)
+{
+    char const* text = R"(
+        contract A {
+            modifier modA() {
+                _;
+                _;
+            }
+            modifier modB() {
+                for (uint i = 0; i < 2; ++i) { _; }
+            }
+            function f() modA() modB() public { }
+            function g() modB() public { }
+        }
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(unit, "A");
+
+    FunctionSpecialization spec_f(*ctrt->definedFunctions()[0]);
+    FunctionSpecialization spec_g(*ctrt->definedFunctions()[1]);
+    BOOST_CHECK(!ModifierBlockConverter::Factory(spec_f).is_linear());
+    BOOST_CHECK(ModifierBlockConverter::Factory(spec_g).is_linear());
+}
+
 BOOST_AUTO_TEST_CASE(library_calls)
 {
     char const* text = R"(
@@ -1119,24 +1144,68 @@ BOOST_AUTO_TEST_CASE(crypto_calls)
             function f(uint value, bytes32 secret, bool fake) public pure {
                 keccak256(abi.encodePacked(value, fake, secret));
             }
+            function g(uint8 value, address owner) public pure {
+                ripemd160(abi.encode(value, owner));
+            }
+            function h(uint value) public pure {
+                sha256(abi.encodeWithSelector(bytes4(0x12345678), value));
+            }
+            function i(bytes4 value) public pure {
+                keccak256(abi.encode(value));
+            }
         }
 	)";
 
     auto const& unit = *parseAndAnalyse(text);
     auto ctrt = retrieveContractByName(unit, "A");
-    auto func = ctrt->definedFunctions()[0];
+    auto const& funcs = ctrt->definedFunctions();
 
     vector<ContractDefinition const*> model({ ctrt });
     vector<SourceUnit const*> full({ &unit });
     auto stack = make_shared<AnalysisStack>(model, full, 0, false, false);
 
-    ostringstream actual, expected;
-    actual << *FunctionBlockConverter(*func, stack).convert();
-    expected << "{";
-    expected << "sol_crypto();";
-    expected << "}";
-
-    BOOST_CHECK_EQUAL(actual.str(), expected.str());
+    {
+        ostringstream actual, expected;
+        actual << *FunctionBlockConverter(*funcs[0], stack).convert();
+        expected << "{";
+        expected << "sol_hash_final(SOL_HASH_KECCAK256,sol_hash_push(";
+        expected << "sol_hash_push(sol_hash_push(SOL_HASH_EMPTY,";
+        expected << "(func_user_value).v,32),(func_user_fake).v,1),";
+        expected << "(func_user_secret).v,32));";
+        expected << "}";
+        BOOST_CHECK_EQUAL(actual.str(), expected.str());
+    }
+
+    {
+        ostringstream actual, expected;
+        actual << *FunctionBlockConverter(*funcs[1], stack).convert();
+        expected << "{";
+        expected << "((sol_raw_uint160_t)(sol_hash_final(SOL_HASH_RIPEMD160,";
+        expected << "sol_hash_push(sol_hash_push(SOL_HASH_EMPTY,";
+        expected << "(func_user_value).v,32),(func_user_owner).v,32))));";
+        expected << "}";
+        BOOST_CHECK_EQUAL(actual.str(), expected.str());
+    }
+
+    {
+        ostringstream actual, expected;
+        actual << *FunctionBlockConverter(*funcs[2], stack).convert();
+        expected << "{";
+        expected << "sol_crypto();";
+        expected << "}";
+        BOOST_CHECK_EQUAL(actual.str(), expected.str());
+    }
+
+    {
+        ostringstream actual, expected;
+        actual << *FunctionBlockConverter(*funcs[3], stack).convert();
+        expected << "{";
+        expected << "sol_hash_final(SOL_HASH_KECCAK256,sol_hash_push(";
+        expected << "sol_hash_push(SOL_HASH_EMPTY,(func_user_value).v,4),";
+        expected << "0,28));";
+        expected << "}";
+        BOOST_CHECK_EQUAL(actual.str(), expected.str());
+    }
 }
 
 BOOST_AUTO_TEST_CASE(constants)
@@ -1192,6 +1261,43 @@ BOOST_AUTO_TEST_CASE(escalation)
     BOOST_CHECK_EQUAL(actual.str(), expected.str());
 }
 
+// Ensures each statement of a block is tagged with its source line. Note that
+// the test framework prepends a pragma to each source unit.
+BOOST_AUTO_TEST_CASE(line_markers)
+{
+    char const* text = R"(
+        contract A {
+            uint a;
+            function f() public {
+                a = 1;
+                if (a > 0) {
+                    a = 2;
+                }
+            }
+        }
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(unit, "A");
+    auto const& func = *ctrt->definedFunctions()[0];
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &unit });
+    auto stack = make_shared<AnalysisStack>(model, full, 0, false, false);
+
+    FunctionBlockConverter converter(func, stack);
+    converter.set_line_markers(true);
+
+    ostringstream actual, expected;
+    actual << *converter.convert();
+    expected << "{";
+    expected << "\n#line 6 \"\"\n((self->user_a).v)=(1);";
+    expected << "\n#line 7 \"\"\nif(((self->user_a).v)>(0)){";
+    expected << "\n#line 8 \"\"\n((self->user_a).v)=(2);}";
+    expected << "}";
+    BOOST_CHECK_EQUAL(actual.str(), expected.str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // -------------------------------------------------------------------------- //
@@ -64,7 +64,9 @@ string _convert_assignment(Token tok)
     return oss.str();
 }
 
-string _convert_bin_op(Token tok)
+string _convert_bin_op(
+    Token tok, OverflowChecks checks = OverflowChecks::NONE, bool sign = false
+)
 {
     auto name_a = make_shared<string>("a");
     auto id_a = make_shared<Identifier>(SourceLocation(), name_a);
@@ -72,11 +74,15 @@ string _convert_bin_op(Token tok)
         SourceLocation(), make_shared<string>("b")
     );
 
-    id_a->annotation().type = new IntegerType(32);
-    id_b->annotation().type = new IntegerType(32);
+    auto const MODIFIER = (sign ? IntegerType::Modifier::Signed
+                                : IntegerType::Modifier::Unsigned);
+    id_a->annotation().type = new IntegerType(32, MODIFIER);
+    id_b->annotation().type = new IntegerType(32, MODIFIER);
 
     BinaryOperation op(SourceLocation(), id_a, tok, id_b);
-    auto s = make_shared<AnalysisStack>(TEST_MODEL, TEST_UNITS, 0, false, false);
+    auto s = make_shared<AnalysisStack>(
+        TEST_MODEL, TEST_UNITS, 0, false, false, false, checks
+    );
     auto r = _prime_resolver(name_a);
 
     ostringstream oss;
@@ -84,10 +90,17 @@ string _convert_bin_op(Token tok)
     return oss.str();
 }
 
-string _convert_unary_op(Token tok, shared_ptr<Expression> expr, bool prefix)
+string _convert_unary_op(
+    Token tok,
+    shared_ptr<Expression> expr,
+    bool prefix,
+    OverflowChecks checks = OverflowChecks::NONE
+)
 {
     UnaryOperation op(SourceLocation(), tok, expr, prefix);
-    auto s = make_shared<AnalysisStack>(TEST_MODEL, TEST_UNITS, 0, false, false);
+    auto s = make_shared<AnalysisStack>(
+        TEST_MODEL, TEST_UNITS, 0, false, false, false, checks
+    );
     auto r = _prime_resolver(make_shared<string>("a"));
 
     ostringstream oss;
@@ -228,6 +241,50 @@ BOOST_AUTO_TEST_CASE(unary_expression)
     );
 }
 
+// Ensures that steps and negations are lowered to libverify helpers when
+// checked.
+BOOST_AUTO_TEST_CASE(checked_unary_expression)
+{
+    auto const ALL = OverflowChecks::ALL;
+
+    auto var = make_shared<Identifier>(
+        SourceLocation(), make_shared<string>("a")
+    );
+    var->annotation().type = new IntegerType(32);
+
+    BOOST_CHECK_EQUAL(
+        _convert_unary_op(Token::Inc, var, true, ALL),
+        "((func_user_a).v)=(sol_add_uint32((func_user_a).v,1))"
+    );
+    BOOST_CHECK_EQUAL(
+        _convert_unary_op(Token::Dec, var, true, ALL),
+        "((func_user_a).v)=(sol_sub_uint32((func_user_a).v,1))"
+    );
+    BOOST_CHECK_EQUAL(
+        _convert_unary_op(Token::Inc, var, false, ALL),
+        "sol_sub_uint32(((func_user_a).v)=(sol_add_uint32((func_user_a).v,1)),1)"
+    );
+    BOOST_CHECK_EQUAL(
+        _convert_unary_op(Token::Dec, var, false, ALL),
+        "sol_add_uint32(((func_user_a).v)=(sol_sub_uint32((func_user_a).v,1)),1)"
+    );
+
+    auto svar = make_shared<Identifier>(
+        SourceLocation(), make_shared<string>("a")
+    );
+    svar->annotation().type = new IntegerType(
+        32, IntegerType::Modifier::Signed
+    );
+
+    BOOST_CHECK_EQUAL(
+        _convert_unary_op(Token::Sub, svar, true, ALL),
+        "sol_sub_int32(0,(func_user_a).v)"
+    );
+    BOOST_CHECK_EQUAL(
+        _convert_unary_op(Token::Sub, svar, true), "-((func_user_a).v)"
+    );
+}
+
 // Ensures that binary expressions map to their corresponding expressions in C.
 BOOST_AUTO_TEST_CASE(binary_expression)
 {
@@ -292,6 +349,33 @@ BOOST_AUTO_TEST_CASE(binary_expression)
     );
 }
 
+// Ensures that arithmetic is lowered to libverify helpers when checked.
+BOOST_AUTO_TEST_CASE(checked_binary_expression)
+{
+    auto const ALL = OverflowChecks::ALL;
+    BOOST_CHECK_EQUAL(
+        _convert_bin_op(Token::Add, ALL),
+        "sol_add_uint32((func_user_a).v,(self->user_b).v)"
+    );
+    BOOST_CHECK_EQUAL(
+        _convert_bin_op(Token::Sub, ALL),
+        "sol_sub_uint32((func_user_a).v,(self->user_b).v)"
+    );
+    BOOST_CHECK_EQUAL(
+        _convert_bin_op(Token::Mul, ALL, true),
+        "sol_mul_int32((func_user_a).v,(self->user_b).v)"
+    );
+    BOOST_CHECK_EQUAL(
+        _convert_bin_op(Token::Div, ALL), "((func_user_a).v)/((self->user_b).v)"
+    );
+
+    // Without further information, no check may be elided.
+    BOOST_CHECK_EQUAL(
+        _convert_bin_op(Token::Add, OverflowChecks::UNPROVEN),
+        "sol_add_uint32((func_user_a).v,(self->user_b).v)"
+    );
+}
+
 // Ensures that identifiers are resolved, using the current scope.
 BOOST_AUTO_TEST_CASE(identifier_expression)
 {
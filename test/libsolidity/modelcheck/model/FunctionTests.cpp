@@ -418,6 +418,172 @@ BOOST_AUTO_TEST_CASE(inherited_duplicates)
     BOOST_CHECK_EQUAL(actual.str(), expect.str());
 }
 
+// Ensures overflow checks are elided only when the operands are small enough.
+BOOST_AUTO_TEST_CASE(elides_proven_overflow_checks)
+{
+    char const* text = R"(
+        contract A {
+            function f(uint8 _a, uint256 _b) public pure returns (uint256) {
+                return (uint256(_a) + 1) * 255 + _b;
+            }
+        }
+    )";
+
+    auto const &ast = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(ast, "A");
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &ast });
+    auto stack = make_shared<AnalysisStack>(
+        model, full, 0, false, false, false, OverflowChecks::UNPROVEN
+    );
+
+    ostringstream actual, expect;
+    FunctionConverter(
+        stack, false, 1, FunctionConverter::View::FULL, false
+    ).print(actual);
+    expect << "void Init_A(struct A*self,sol_address_t sender,sol_uint256_t "
+           << "value,sol_uint256_t blocknum,sol_uint256_t timestamp,sol_bool_t "
+           << "paid,sol_address_t origin)";
+    expect << "{";
+    expect << "((self)->model_balance)=(Init_sol_uint256_t(0));";
+    expect << "}";
+    expect << "sol_uint256_t A_Method_f(struct A*self,sol_address_t sender"
+           << ",sol_uint256_t value,sol_uint256_t blocknum,sol_uint256_t "
+           << "timestamp,sol_bool_t paid,sol_address_t origin,sol_uint8_t "
+           << "func_user___a,sol_uint256_t func_user___b)";
+    expect << "{";
+    expect << "{return Init_sol_uint256_t(sol_add_uint256("
+           << "(((func_user___a).v)+(1))*(255),(func_user___b).v));}";
+    expect << "}";
+
+    BOOST_CHECK_EQUAL(actual.str(), expect.str());
+}
+
+// Ensures addmod and mulmod are lowered to their libverify implementations.
+BOOST_AUTO_TEST_CASE(modular_arithmetic)
+{
+    char const* text = R"(
+        contract A {
+            function f(uint256 _a, uint8 _m) public pure returns (uint256) {
+                return addmod(_a, 3, _m) + mulmod(_a, _a, 7);
+            }
+        }
+    )";
+
+    auto const &ast = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(ast, "A");
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &ast });
+    auto stack = make_shared<AnalysisStack>(model, full, 0, false, false);
+
+    ostringstream actual, expect;
+    FunctionConverter(
+        stack, false, 1, FunctionConverter::View::FULL, false
+    ).print(actual);
+    expect << "void Init_A(struct A*self,sol_address_t sender,sol_uint256_t "
+           << "value,sol_uint256_t blocknum,sol_uint256_t timestamp,sol_bool_t "
+           << "paid,sol_address_t origin)";
+    expect << "{";
+    expect << "((self)->model_balance)=(Init_sol_uint256_t(0));";
+    expect << "}";
+    expect << "sol_uint256_t A_Method_f(struct A*self,sol_address_t sender"
+           << ",sol_uint256_t value,sol_uint256_t blocknum,sol_uint256_t "
+           << "timestamp,sol_bool_t paid,sol_address_t origin,sol_uint256_t "
+           << "func_user___a,sol_uint8_t func_user___m)";
+    expect << "{";
+    expect << "{return Init_sol_uint256_t("
+           << "(sol_addmod_uint256((func_user___a).v,3,(func_user___m).v))+"
+           << "(sol_mulmod_uint256((func_user___a).v,(func_user___a).v,7)));}";
+    expect << "}";
+
+    BOOST_CHECK_EQUAL(actual.str(), expect.str());
+}
+
+// Ensures that modifier chains are inlined only after their entry point.
+BOOST_AUTO_TEST_CASE(inlined_modifiers)
+{
+    char const* text = R"(
+        contract A {
+            modifier modA() { _; }
+            modifier modB() { _; }
+            function f() public modA() modB() { }
+        }
+    )";
+
+    auto const &ast = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(ast, "A");
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &ast });
+    auto stack = make_shared<AnalysisStack>(model, full, 0, false, false);
+
+    string const PARAMS = "(struct A*self,sol_address_t sender,sol_uint256_t "
+                          "value,sol_uint256_t blocknum,sol_uint256_t "
+                          "timestamp,sol_bool_t paid,sol_address_t origin)";
+    string const ARGS = "(self,sender,value,blocknum,timestamp,"
+                        "Init_sol_bool_t(0),origin);";
+
+    ostringstream fwd_actual, fwd_expect;
+    FunctionConverter(
+        stack, false, 1, FunctionConverter::View::EXT, true, true
+    ).print(fwd_actual);
+    fwd_expect << "void Init_A" << PARAMS << ";";
+    fwd_expect << "void A_Method_f" << PARAMS << ";";
+    BOOST_CHECK_EQUAL(fwd_actual.str(), fwd_expect.str());
+
+    ostringstream def_actual, def_expect;
+    FunctionConverter(
+        stack, false, 1, FunctionConverter::View::FULL, false, true
+    ).print(def_actual);
+    def_expect << "void Init_A" << PARAMS;
+    def_expect << "{((self)->model_balance)=(Init_sol_uint256_t(0));}";
+    def_expect << "SOL_ALWAYS_INLINE void A_Method_2_f" << PARAMS << "{}";
+    def_expect << "SOL_ALWAYS_INLINE void A_Method_1_f" << PARAMS;
+    def_expect << "{A_Method_2_f" << ARGS << "}";
+    def_expect << "void A_Method_f" << PARAMS;
+    def_expect << "{A_Method_1_f" << ARGS << "}";
+    BOOST_CHECK_EQUAL(def_actual.str(), def_expect.str());
+}
+
+BOOST_AUTO_TEST_CASE(shared_env_params)
+{
+    char const* text = R"(
+        contract A {
+            uint a;
+            address b;
+            function f() public { a = block.number + now; b = tx.origin; }
+        }
+    )";
+
+    auto const &ast = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(ast, "A");
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &ast });
+    auto stack = make_shared<AnalysisStack>(
+        model, full, 0, false, false, false, OverflowChecks::NONE, true
+    );
+
+    string const PARAMS = "(struct A*self,struct sol_env*env,sol_address_t "
+                          "sender,sol_uint256_t value,sol_bool_t paid)";
+
+    ostringstream actual, expect;
+    FunctionConverter(
+        stack, false, 1, FunctionConverter::View::FULL, false
+    ).print(actual);
+    expect << "void Init_A" << PARAMS;
+    expect << "{((self)->model_balance)=(Init_sol_uint256_t(0));";
+    expect << "((self)->user_a)=(Init_sol_uint256_t(0));";
+    expect << "((self)->user_b)=(Init_sol_address_t(0));}";
+    expect << "void A_Method_f" << PARAMS;
+    expect << "{((self->user_a).v)=((((env)->blocknum).v)+"
+           << "(((env)->timestamp).v));";
+    expect << "((self->user_b).v)=(((env)->origin).v);}";
+    BOOST_CHECK_EQUAL(actual.str(), expect.str());
+}
+
 // -------------------------------------------------------------------------- //
 
 BOOST_AUTO_TEST_SUITE_END();
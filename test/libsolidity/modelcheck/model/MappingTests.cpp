@@ -9,6 +9,9 @@
 #include <boost/test/unit_test.hpp>
 #include <test/libsolidity/AnalysisFramework.h>
 
+#include <libsolidity/modelcheck/analysis/AnalysisStack.h>
+#include <libsolidity/modelcheck/analysis/TypeNames.h>
+
 #include <sstream>
 
 using namespace std;
@@ -28,6 +31,63 @@ BOOST_FIXTURE_TEST_SUITE(
     Model_MappingTests, ::dev::solidity::test::AnalysisFramework
 )
 
+BOOST_AUTO_TEST_CASE(entries)
+{
+    char const* text = R"(
+        contract A {
+            mapping(address => uint) a;
+            mapping(address => mapping(address => bool)) b;
+        }
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(unit, "A");
+    auto const& vars = ctrt->stateVariables();
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &unit });
+    auto stack = make_shared<AnalysisStack>(model, full, 0, false, false);
+
+    auto const& a = dynamic_cast<Mapping const&>(*vars[0]->typeName());
+    auto const& b = dynamic_cast<Mapping const&>(*vars[1]->typeName());
+
+    vector<string> a_expect({ "data_0", "data_1" });
+    auto a_actual = MapGenerator(a, false, 2, *stack->types()).entries();
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        a_actual.begin(), a_actual.end(), a_expect.begin(), a_expect.end()
+    );
+
+    vector<string> b_expect({ "data_0_0", "data_0_1", "data_1_0", "data_1_1" });
+    auto b_actual = MapGenerator(b, true, 2, *stack->types()).entries();
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        b_actual.begin(), b_actual.end(), b_expect.begin(), b_expect.end()
+    );
+}
+
+BOOST_AUTO_TEST_CASE(zero_entries)
+{
+    char const* text = R"(
+        contract A {
+            mapping(address => uint) a;
+            mapping(address => mapping(address => bool)) b;
+        }
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto ctrt = retrieveContractByName(unit, "A");
+    auto const& vars = ctrt->stateVariables();
+
+    vector<ContractDefinition const*> model({ ctrt });
+    vector<SourceUnit const*> full({ &unit });
+    auto stack = make_shared<AnalysisStack>(model, full, 0, false, false);
+
+    auto const& a = dynamic_cast<Mapping const&>(*vars[0]->typeName());
+    auto const& b = dynamic_cast<Mapping const&>(*vars[1]->typeName());
+
+    BOOST_CHECK_THROW(MapGenerator(a, false, 0, *stack->types()), runtime_error);
+    BOOST_CHECK_THROW(MapGenerator(b, true, 0, *stack->types()), runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 
 // -------------------------------------------------------------------------- //
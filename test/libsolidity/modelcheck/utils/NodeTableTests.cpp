@@ -0,0 +1,124 @@
+/**
+ * Tests for libsolidity/modelcheck/utils/NodeTable.
+ *
+ * @date 2020
+ */
+
+#include <libsolidity/modelcheck/utils/NodeTable.h>
+
+#include <boost/test/unit_test.hpp>
+#include <test/libsolidity/AnalysisFramework.h>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace modelcheck
+{
+namespace test
+{
+
+// -------------------------------------------------------------------------- //
+
+BOOST_FIXTURE_TEST_SUITE(
+    Utils_NodeTableTests, ::dev::solidity::test::AnalysisFramework
+)
+
+BOOST_AUTO_TEST_CASE(insert_and_find)
+{
+    char const* text = R"(
+        contract A {}
+        contract B {}
+        contract C {}
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto const* a = retrieveContractByName(unit, "A");
+    auto const* b = retrieveContractByName(unit, "B");
+    auto const* c = retrieveContractByName(unit, "C");
+
+    NodeTable<int> table;
+    BOOST_CHECK_EQUAL(table.size(), 0);
+    BOOST_CHECK(table.find(*a) == nullptr);
+
+    BOOST_CHECK(table.insert(*b, 2));
+    BOOST_CHECK(!table.insert(*b, 3));
+    BOOST_CHECK(table.contains(*b));
+    BOOST_CHECK(!table.contains(*a));
+    BOOST_CHECK(!table.contains(*c));
+    BOOST_REQUIRE(table.find(*b) != nullptr);
+    BOOST_CHECK_EQUAL(*table.find(*b), 2);
+
+    table[*a] = 1;
+    table[*b] += 5;
+    BOOST_CHECK_EQUAL(table.size(), 2);
+    BOOST_CHECK_EQUAL(*table.find(*a), 1);
+    BOOST_CHECK_EQUAL(*table.find(*b), 7);
+    BOOST_CHECK(table.find(*c) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(for_each_in_id_order)
+{
+    char const* text = R"(
+        contract A {}
+        contract B {}
+        contract C {}
+    )";
+
+    auto const& unit = *parseAndAnalyse(text);
+    auto const* a = retrieveContractByName(unit, "A");
+    auto const* b = retrieveContractByName(unit, "B");
+    auto const* c = retrieveContractByName(unit, "C");
+
+    NodeTable<string> table;
+    table[*c] = "C";
+    table[*a] = "A";
+    table[*b] = "B";
+
+    vector<string> order;
+    table.for_each([&order](ASTNode const& _node, string const& _val) {
+        BOOST_CHECK_EQUAL(
+            dynamic_cast<ContractDefinition const&>(_node).name(), _val
+        );
+        order.push_back(_val);
+    });
+
+    BOOST_CHECK_EQUAL(order.size(), 3);
+    BOOST_CHECK_EQUAL(order[0], "A");
+    BOOST_CHECK_EQUAL(order[1], "B");
+    BOOST_CHECK_EQUAL(order[2], "C");
+}
+
+BOOST_AUTO_TEST_CASE(name_table)
+{
+    NameTable names;
+    auto const ID_1 = names.intern("x");
+    auto const ID_2 = names.intern("y");
+    BOOST_CHECK_NE(ID_1, ID_2);
+    BOOST_CHECK_EQUAL(names.intern("x"), ID_1);
+    BOOST_CHECK_EQUAL(names.size(), 2);
+    BOOST_CHECK_EQUAL(names.at(ID_1), "x");
+    BOOST_CHECK_EQUAL(names.at(ID_2), "y");
+
+    NameTable copy(names);
+    copy.intern("z");
+    names = NameTable();
+    BOOST_CHECK_EQUAL(copy.size(), 3);
+    BOOST_CHECK_EQUAL(copy.at(ID_1), "x");
+    BOOST_CHECK_EQUAL(copy.at(ID_2), "y");
+    BOOST_CHECK_EQUAL(names.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// -------------------------------------------------------------------------- //
+
+}
+}
+}
+}
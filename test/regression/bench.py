@@ -0,0 +1,390 @@
+#!/usr/bin/env python3
+"""
+Benchmarks the pipeline over the regression contracts. Each contract is
+translated with the solc arguments of its first RUN line, and its project is
+configured with the arguments of its first cmake RUN line. The following are
+then recorded for each contract:
+- gen_time: the time taken by solc (the best of --repeat runs);
+- cmodel_bytes, cmodel_lines, model_bytes: the size of cmodel.c, and of all
+  generated C sources;
+- configure_time, build_time: the time taken by cmake, and by make icmodel;
+- verify_time, verify_result: the time and result of make verify;
+- fuzz_execs_per_sec: the throughput of fuzztest on a fresh corpus;
+- klee_paths_per_sec: the paths completed by make symbex, per second;
+- simulate_runs_per_sec: the throughput of rcmodel.
+Backends are opt-in (see --backends). A backend which cannot be built is
+recorded under errors, and does not stop the benchmark.
+
+The report is written as JSON, and is compared against a baseline by
+bench_compare.py. As with lit, tools are found through SOLC, CMAKE, SEA_PATH,
+KLEE_PATH and KLEE_LIB. The compilers used by cmake may be set through CC and
+CXX (the fuzzer requires clang).
+"""
+
+from argparse import ArgumentParser
+import datetime
+import glob
+import json
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+REPORT_VERSION = 1
+
+BACKENDS = ["build", "verify", "fuzz", "klee", "simulate"]
+
+SUITES = ["interactive", "explicit", "fuzzer", "klee", "simulate", "verify",
+          "tutorials"]
+
+GENERATED_SOURCES = ["*.c", "*.h"]
+
+# Maps each path placeholder of the RUN lines to its environment variable,
+# which is also the cache variable of the generated project.
+PATH_VARS = {
+    "%seapath": "SEA_PATH",
+    "%kleepath": "KLEE_PATH",
+    "%kleelib": "KLEE_LIB",
+}
+
+RE_RUN = re.compile(r"^\s*//\s*RUN:\s*(.*)$")
+RE_FUZZ = re.compile(r"average_exec_per_sec:\s*([0-9]+)")
+RE_KLEE = re.compile(r"completed paths\s*=\s*([0-9]+)")
+RE_SIMULATE = re.compile(r"Runs/sec:\s*([0-9]+)")
+
+# -------------------------------------------------------------------------- #
+
+
+class StepError(Exception):
+    """Raised when a step of the pipeline fails."""
+    pass
+
+
+def find_tool(name, default):
+    """Returns the tool given by the environment variable name, or default."""
+    exe = os.environ.get(name, None) or shutil.which(default)
+    if not exe or not os.access(exe, os.X_OK):
+        sys.exit("Could not find executable: {}".format(default))
+    return exe
+
+
+def run_lines(path):
+    """Returns the RUN lines of the contract at path."""
+    lines = []
+    with open(path) as src:
+        for line in src:
+            match = RE_RUN.match(line)
+            if match:
+                lines.append(match.group(1))
+    return lines
+
+
+def solc_args(path, outdir):
+    """Returns the solc arguments of the first solc RUN line, with the output
+    redirected to outdir."""
+    for line in run_lines(path):
+        argv = shlex.split(line)
+        if argv and argv[0] == "%solc":
+            args = []
+            for arg in argv[1:]:
+                if arg.startswith("--output-dir"):
+                    continue
+                args.append(path if arg == "%s" else arg)
+            return args + ["--output-dir=" + outdir]
+    return None
+
+
+def cmake_args(path, tool_paths):
+    """Returns the cache definitions of the first cmake configure RUN line.
+    Each path placeholder is replaced by its value in tool_paths, and each
+    definition with an unset value is dropped. Paths which are set, but unused
+    by the RUN line, are also defined."""
+    argv = ["-DSEA_PATH=%seapath"]
+    for line in run_lines(path):
+        words = shlex.split(line)
+        if not words or words[0] not in ("cmake", "%cmake"):
+            continue
+        if "--build" not in words:
+            argv = words[1:]
+            break
+
+    args = []
+    for arg in argv:
+        if not arg.startswith("-D"):
+            continue
+        for key, val in tool_paths.items():
+            if key in arg:
+                arg = arg.replace(key, val) if val else None
+                break
+        if arg:
+            args.append(arg)
+    for key, val in tool_paths.items():
+        if val and not any(key in arg for arg in argv):
+            args.append("-D{}={}".format(PATH_VARS[key], val))
+    return args
+
+
+def execute(argv, cwd, timeout):
+    """Runs argv in cwd, and returns its exit code, output and elapsed time."""
+    start = time.perf_counter()
+    try:
+        res = subprocess.run(
+            argv, cwd=cwd, timeout=timeout,
+            stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+            universal_newlines=True)
+    except subprocess.TimeoutExpired:
+        raise StepError("{} timed out after {}s".format(argv[0], timeout))
+    return res.returncode, res.stdout, time.perf_counter() - start
+
+
+def build(cmake, target, cwd, timeout):
+    """Builds target, and returns the time taken."""
+    code, out, elapsed = execute(
+        [cmake, "--build", ".", "--target", target], cwd, timeout)
+    if code != 0:
+        raise StepError("failed to build {}:\n{}".format(target, out[-2000:]))
+    return elapsed
+
+
+def generated_size(outdir):
+    """Returns the size of cmodel.c in bytes and lines, and the total size in
+    bytes of all generated sources."""
+    with open(os.path.join(outdir, "cmodel.c"), "rb") as src:
+        cmodel = src.read()
+    total = 0
+    for pattern in GENERATED_SOURCES:
+        for fn in glob.glob(os.path.join(outdir, pattern)):
+            total += os.path.getsize(fn)
+    return len(cmodel), cmodel.count(b"\n"), total
+
+# -------------------------------------------------------------------------- #
+
+
+class Benchmark(object):
+    """Benchmarks a single contract within a fresh project directory."""
+
+    def __init__(self, args, tools, path, outdir):
+        self.args = args
+        self.tools = tools
+        self.path = path
+        self.outdir = outdir
+        self.record = {"errors": []}
+
+    def run(self):
+        """Runs each requested step, and returns the record of the contract."""
+        steps = [("gen", self.generate)]
+        if self.args.backends:
+            steps.append(("configure", self.configure))
+        for backend in BACKENDS:
+            if backend in self.args.backends:
+                steps.append((backend, getattr(self, "run_" + backend)))
+
+        for name, step in steps:
+            try:
+                step()
+            except StepError as err:
+                self.record["errors"].append("{}: {}".format(name, err))
+                if name in ("gen", "configure"):
+                    break
+        return self.record
+
+    def generate(self):
+        args = solc_args(self.path, self.outdir)
+        if args is None:
+            raise StepError("no solc RUN line")
+
+        # solc reports missing resources when run from the build directory, so
+        # success is judged by the model itself.
+        best = None
+        for _ in range(self.args.repeat):
+            shutil.rmtree(self.outdir, ignore_errors=True)
+            code, out, elapsed = execute(
+                [self.tools["solc"]] + args, None, self.args.timeout)
+            if not os.path.isfile(os.path.join(self.outdir, "cmodel.c")):
+                raise StepError("exit code {}:\n{}".format(code, out[-2000:]))
+            best = elapsed if best is None else min(best, elapsed)
+
+        size = generated_size(self.outdir)
+        self.record["gen_time"] = best
+        self.record["cmodel_bytes"] = size[0]
+        self.record["cmodel_lines"] = size[1]
+        self.record["model_bytes"] = size[2]
+
+    def configure(self):
+        argv = [self.tools["cmake"], "."]
+        argv += cmake_args(self.path, self.args.tool_paths)
+        argv += self.args.cmake_arg
+
+        code, out, elapsed = execute(argv, self.outdir, self.args.timeout)
+        if code != 0:
+            raise StepError("cmake failed:\n{}".format(out[-2000:]))
+        self.record["configure_time"] = elapsed
+
+    def run_build(self):
+        cmake = self.tools["cmake"]
+        self.record["build_time"] = build(
+            cmake, "icmodel", self.outdir, self.args.timeout)
+
+    def run_verify(self):
+        code, out, elapsed = execute(
+            [self.tools["cmake"], "--build", ".", "--target", "verify"],
+            self.outdir, self.args.timeout)
+        if code != 0:
+            raise StepError("verify failed:\n{}".format(out[-2000:]))
+        self.record["verify_time"] = elapsed
+        if re.search(r"(^|\n)unsat", out):
+            self.record["verify_result"] = "unsat"
+        elif re.search(r"(^|\n)sat", out):
+            self.record["verify_result"] = "sat"
+        else:
+            self.record["verify_result"] = "unknown"
+
+    def run_fuzz(self):
+        cmake = self.tools["cmake"]
+        self.record["fuzz_build_time"] = build(
+            cmake, "fuzztest", self.outdir, self.args.timeout)
+
+        # As in make bench, a fixed seed is used on an empty corpus.
+        corpus = os.path.join(self.outdir, "bench_dir")
+        os.makedirs(corpus, exist_ok=True)
+        _, out, _ = execute(
+            ["./fuzztest", corpus, "-runs={}".format(self.args.fuzz_runs),
+             "-seed=1", "-max_len=20000", "-print_final_stats=1"],
+            self.outdir, self.args.timeout)
+        match = RE_FUZZ.search(out)
+        if not match:
+            raise StepError("no statistics:\n{}".format(out[-2000:]))
+        self.record["fuzz_execs_per_sec"] = int(match.group(1))
+
+    def run_klee(self):
+        cmake = self.tools["cmake"]
+        build(cmake, "klee_driver", self.outdir, self.args.timeout)
+        code, out, elapsed = execute(
+            [cmake, "--build", ".", "--target", "symbex"],
+            self.outdir, self.args.timeout)
+        match = RE_KLEE.search(out)
+        if code != 0 or not match:
+            raise StepError("symbex failed:\n{}".format(out[-2000:]))
+        self.record["klee_time"] = elapsed
+        self.record["klee_paths_per_sec"] = int(match.group(1)) / elapsed
+
+    def run_simulate(self):
+        cmake = self.tools["cmake"]
+        build(cmake, "rcmodel", self.outdir, self.args.timeout)
+        _, out, _ = execute(
+            ["./rcmodel", "--runs={}".format(self.args.simulate_runs),
+             "--threads=1", "--return-0"],
+            self.outdir, self.args.timeout)
+        match = RE_SIMULATE.search(out)
+        if not match:
+            raise StepError("no statistics:\n{}".format(out[-2000:]))
+        self.record["simulate_runs_per_sec"] = int(match.group(1))
+
+# -------------------------------------------------------------------------- #
+
+
+def find_contracts(root, paths):
+    """Returns all contracts under paths, relative to root."""
+    if not paths:
+        paths = [os.path.join(root, suite) for suite in SUITES]
+    contracts = []
+    for path in paths:
+        if os.path.isdir(path):
+            contracts += glob.glob(os.path.join(path, "*.sol"))
+        elif os.path.isfile(path):
+            contracts.append(path)
+        else:
+            sys.exit("No such contract or suite: {}".format(path))
+    return sorted(os.path.relpath(os.path.abspath(c), root) for c in contracts)
+
+
+def parse_args():
+    parser = ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument(
+        "paths", nargs="*",
+        help="Contracts or suites to benchmark (default: all suites).")
+    parser.add_argument(
+        "-o", "--output", default="bench.json",
+        help="The path to which the report is written.")
+    parser.add_argument(
+        "--backends", default="",
+        help="A comma-separated subset of: " + ", ".join(BACKENDS) + ".")
+    parser.add_argument(
+        "--repeat", type=int, default=3,
+        help="The number of times each model is generated.")
+    parser.add_argument(
+        "--timeout", type=int, default=600,
+        help="The time limit, in seconds, of each step.")
+    parser.add_argument(
+        "--fuzz-runs", type=int, default=100000,
+        help="The number of inputs run by the fuzzer.")
+    parser.add_argument(
+        "--simulate-runs", type=int, default=100000,
+        help="The number of runs of the random-walk runtime.")
+    parser.add_argument(
+        "--cmake-arg", action="append", default=[],
+        help="An extra argument to cmake. May be given several times.")
+    parser.add_argument(
+        "--work-dir", default=None,
+        help="Keeps each project in this directory, rather than a temporary.")
+    args = parser.parse_args()
+
+    args.backends = [b for b in args.backends.split(",") if b]
+    for backend in args.backends:
+        if backend not in BACKENDS:
+            parser.error("Unknown backend: {}".format(backend))
+    if args.repeat < 1:
+        parser.error("--repeat must be positive.")
+
+    args.tool_paths = {
+        key: os.environ.get(var, None) for key, var in PATH_VARS.items()
+    }
+    return args
+
+
+def main():
+    args = parse_args()
+    root = os.path.dirname(os.path.abspath(__file__))
+    tools = {
+        "solc": os.path.abspath(find_tool("SOLC", "solc")),
+        "cmake": find_tool("CMAKE", "cmake"),
+    }
+
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix="smartace_bench_")
+    contracts = {}
+    try:
+        for contract in find_contracts(root, args.paths):
+            outdir = os.path.abspath(
+                os.path.join(work_dir, os.path.splitext(contract)[0]))
+            print("{}...".format(contract), flush=True)
+            path = os.path.join(root, contract)
+            record = Benchmark(args, tools, path, outdir).run()
+            for err in record["errors"]:
+                print("  " + err.split("\n")[0])
+            contracts[contract] = record
+    finally:
+        if not args.work_dir:
+            shutil.rmtree(work_dir, ignore_errors=True)
+
+    report = {
+        "version": REPORT_VERSION,
+        "date": datetime.datetime.now().isoformat(timespec="seconds"),
+        "solc": tools["solc"],
+        "backends": args.backends,
+        "repeat": args.repeat,
+        "fuzz_runs": args.fuzz_runs,
+        "simulate_runs": args.simulate_runs,
+        "contracts": contracts,
+    }
+    with open(args.output, "w") as out:
+        json.dump(report, out, indent=2, sort_keys=True)
+        out.write("\n")
+    print("Wrote {} contract(s) to {}".format(len(contracts), args.output))
+
+
+if __name__ == "__main__":
+    main()
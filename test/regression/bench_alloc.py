@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""
+Counts the heap allocations made by solc when generating the model of a large
+multi-contract bundle. The bundle is generated with --contracts contracts, each
+of which has maps, a nested map and a struct with a map. Each solc binary is run
+twice with malloc_count.c preloaded: once to parse and analyse the bundle, and
+once with --c-model. The following are then recorded for each binary:
+- parse_mallocs: the malloc calls made to parse and analyse the bundle;
+- model_mallocs: the malloc calls made with --c-model;
+- cmodel_bytes: the size of cmodel.c.
+The difference between model_mallocs and parse_mallocs is the cost of model
+generation. Several binaries may be given (e.g., a baseline and a candidate).
+
+The shim is built with CC (default: cc). It relies on RTLD_NEXT, and so is only
+supported on Linux.
+"""
+
+from argparse import ArgumentParser
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+CONTRACT_TEMPLATE = """
+contract C{i} {{
+    struct S{i} {{ uint a; uint b; mapping(address => uint) m; }}
+    mapping(address => uint) bal;
+    mapping(address => mapping(address => uint)) allow;
+    S{i} s;
+    uint total;
+    address owner;
+    constructor() public {{ owner = msg.sender; }}
+    function deposit() public payable {{
+        bal[msg.sender] += msg.value;
+        total += msg.value;
+    }}
+    function approve(address a, uint v) public {{ allow[msg.sender][a] = v; }}
+    function move(address a, uint v) public {{
+        require(bal[msg.sender] >= v);
+        bal[msg.sender] -= v;
+        bal[a] += v;
+        helper(v);
+    }}
+    function helper(uint v) internal {{ s.a += v; s.m[msg.sender] = s.b; }}
+    function peek() public view returns (uint) {{ return total + s.a; }}
+}}
+"""
+
+# -------------------------------------------------------------------------- #
+
+
+def write_bundle(path, count):
+    """Writes a bundle of count independent contracts to path, and returns the
+    names of its contracts."""
+    names = ["C{}".format(i) for i in range(count)]
+    with open(path, "w") as out:
+        out.write("pragma solidity ^0.5.0;\n")
+        for i in range(count):
+            out.write(CONTRACT_TEMPLATE.format(i=i))
+    return names
+
+
+def build_shim(cc, work_dir):
+    """Builds malloc_count.c into work_dir, and returns the library path."""
+    src = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                       "malloc_count.c")
+    lib = os.path.join(work_dir, "malloc_count.so")
+    res = subprocess.run(
+        [cc, "-O2", "-shared", "-fPIC", "-o", lib, src, "-ldl"],
+        stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+        universal_newlines=True)
+    if res.returncode != 0:
+        sys.exit("Failed to build malloc_count.c:\n" + res.stdout)
+    return lib
+
+
+def count_mallocs(argv, shim, work_dir, timeout):
+    """Runs argv with shim preloaded, and returns the malloc calls it made."""
+    count_file = os.path.join(work_dir, "malloc_count.txt")
+    env = dict(os.environ)
+    env["LD_PRELOAD"] = shim
+    env["MALLOC_COUNT_FILE"] = count_file
+    res = subprocess.run(
+        argv, cwd=work_dir, env=env, timeout=timeout,
+        stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+        universal_newlines=True)
+    if res.returncode != 0:
+        sys.exit("{} failed:\n{}".format(argv[0], res.stdout))
+    with open(count_file) as src:
+        return int(src.read().strip())
+
+
+def measure(solc, bundle, names, shim, work_dir, timeout):
+    """Returns the record of solc over bundle."""
+    outdir = os.path.join(work_dir, "model")
+    shutil.rmtree(outdir, ignore_errors=True)
+
+    parse = count_mallocs([solc, bundle], shim, work_dir, timeout)
+    model = count_mallocs(
+        [solc, bundle, "--c-model", "--bundle"] + names
+        + ["--output-dir=" + outdir],
+        shim, work_dir, timeout)
+    return {
+        "parse_mallocs": parse,
+        "model_mallocs": model,
+        "cmodel_bytes": os.path.getsize(os.path.join(outdir, "cmodel.c")),
+    }
+
+
+def parse_args():
+    parser = ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument(
+        "solc", nargs="*",
+        help="The solc binaries to measure (default: SOLC, or solc).")
+    parser.add_argument(
+        "-o", "--output", default="bench_alloc.json",
+        help="The path to which the report is written.")
+    parser.add_argument(
+        "--contracts", type=int, default=40,
+        help="The number of contracts in the bundle.")
+    parser.add_argument(
+        "--timeout", type=int, default=600,
+        help="The time limit, in seconds, of each run of solc.")
+    parser.add_argument(
+        "--work-dir", default=None,
+        help="Keeps the bundle and model in this directory.")
+    args = parser.parse_args()
+
+    if args.contracts < 1:
+        parser.error("--contracts must be positive.")
+    if not args.solc:
+        solc = os.environ.get("SOLC", None) or shutil.which("solc")
+        if not solc:
+            parser.error("Could not find executable: solc")
+        args.solc = [solc]
+    return args
+
+
+def main():
+    args = parse_args()
+    cc = os.environ.get("CC", None) or shutil.which("cc")
+    if not cc:
+        sys.exit("Could not find executable: cc")
+
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix="smartace_alloc_")
+    os.makedirs(work_dir, exist_ok=True)
+    records = {}
+    try:
+        shim = build_shim(cc, work_dir)
+        bundle = os.path.join(work_dir, "bundle.sol")
+        names = write_bundle(bundle, args.contracts)
+        for solc in args.solc:
+            solc = os.path.abspath(solc)
+            record = measure(solc, bundle, names, shim, work_dir, args.timeout)
+            print("{}: {} malloc calls ({} to parse)".format(
+                solc, record["model_mallocs"], record["parse_mallocs"]))
+            records[solc] = record
+    finally:
+        if not args.work_dir:
+            shutil.rmtree(work_dir, ignore_errors=True)
+
+    report = {"contracts": args.contracts, "solc": records}
+    with open(args.output, "w") as out:
+        json.dump(report, out, indent=2, sort_keys=True)
+        out.write("\n")
+    print("Wrote {} record(s) to {}".format(len(records), args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+Compares a benchmark report against a baseline, as written by bench.py. A
+metric regresses if it is worse than the baseline by more than the tolerance.
+Times and sizes are worse when larger, and throughputs are worse when smaller.
+Times below --min-time are too noisy to compare, and are skipped, but are still
+checked through the total of each time and size over all contracts. A contract
+regresses if it fails a step which succeeded in the baseline, or if its result
+under make verify changes. Returns 1 if any regression is found.
+"""
+
+from argparse import ArgumentParser
+import json
+import sys
+
+REPORT_VERSION = 1
+
+# Maps each metric to True if a larger value is worse.
+METRICS = {
+    "gen_time": True,
+    "cmodel_bytes": True,
+    "cmodel_lines": True,
+    "model_bytes": True,
+    "configure_time": True,
+    "build_time": True,
+    "verify_time": True,
+    "fuzz_build_time": True,
+    "fuzz_execs_per_sec": False,
+    "klee_time": True,
+    "klee_paths_per_sec": False,
+    "simulate_runs_per_sec": False,
+}
+
+# -------------------------------------------------------------------------- #
+
+
+def load(path):
+    with open(path) as src:
+        report = json.load(src)
+    if report.get("version", None) != REPORT_VERSION:
+        sys.exit("{}: unsupported report version.".format(path))
+    return report
+
+
+def is_time(metric):
+    return metric.endswith("_time")
+
+
+def show(val):
+    return str(val) if isinstance(val, int) else "{:.3f}".format(val)
+
+
+def compare_contract(args, name, old, new):
+    """Returns the (regressions, improvements) of a single contract."""
+    regressions = []
+    improvements = []
+
+    old_steps = set(e.split(":")[0] for e in old.get("errors", []))
+    for err in new.get("errors", []):
+        step = err.split(":")[0]
+        if step not in old_steps:
+            regressions.append("{}: {} now fails".format(name, step))
+
+    if old.get("verify_result", None) != new.get("verify_result", None):
+        if "verify_result" in old and "verify_result" in new:
+            regressions.append("{}: verify_result {} -> {}".format(
+                name, old["verify_result"], new["verify_result"]))
+
+    for metric, larger_is_worse in sorted(METRICS.items()):
+        if metric not in old or metric not in new:
+            continue
+        before = old[metric]
+        after = new[metric]
+        if is_time(metric) and max(before, after) < args.min_time:
+            continue
+        if before == 0:
+            continue
+
+        change = (after - before) / before
+        worse = change if larger_is_worse else -change
+        line = "{}: {} {} -> {} ({:+.1f}%)".format(
+            name, metric, show(before), show(after), 100 * change)
+        if worse > args.tolerance:
+            regressions.append(line)
+        elif worse < -args.tolerance:
+            improvements.append(line)
+    return regressions, improvements
+
+
+def totals(baseline, report):
+    """Returns the totals of each time and size, over the contracts for which
+    both reports record said metric."""
+    old = {}
+    new = {}
+    for metric, larger_is_worse in METRICS.items():
+        if not larger_is_worse:
+            continue
+        for name in baseline:
+            if metric in baseline[name] and metric in report.get(name, {}):
+                old[metric] = old.get(metric, 0) + baseline[name][metric]
+                new[metric] = new.get(metric, 0) + report[name][metric]
+    return old, new
+
+
+def main():
+    parser = ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument("baseline", help="The stored baseline report.")
+    parser.add_argument("report", help="The report to check.")
+    parser.add_argument(
+        "--tolerance", type=float, default=0.10,
+        help="The relative change permitted before a metric regresses.")
+    parser.add_argument(
+        "--min-time", type=float, default=0.05,
+        help="Times, in seconds, below which no change is reported.")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)["contracts"]
+    report = load(args.report)["contracts"]
+
+    regressions = []
+    improvements = []
+    for name in sorted(baseline):
+        if name not in report:
+            print("{}: missing from report".format(name))
+            continue
+        res = compare_contract(args, name, baseline[name], report[name])
+        regressions += res[0]
+        improvements += res[1]
+    for name in sorted(set(report) - set(baseline)):
+        print("{}: missing from baseline".format(name))
+    res = compare_contract(args, "total", *totals(baseline, report))
+    regressions += res[0]
+    improvements += res[1]
+
+    if improvements:
+        print("Improvements:")
+        for line in improvements:
+            print("  " + line)
+    if regressions:
+        print("Regressions:")
+        for line in regressions:
+            print("  " + line)
+    print("{} regression(s), {} improvement(s) over {} contract(s).".format(
+        len(regressions), len(improvements), len(baseline)))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,19 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=4 --values=2 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * The contract state never changes, but the block number does. States which
+ * differ only by the block number must not be merged, or else the violation is
+ * missed.
+ */
+
+contract A {
+	function g() public view {
+		assert(block.number < 6);
+	}
+}
@@ -0,0 +1,23 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=2 --depth=4 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * The counter reaches 3 after three bounded increments. The search must find
+ * this violation, and its trace must replay in the interactive model.
+ */
+
+contract Contract {
+	uint8 count;
+	function incr(uint8 _v) public {
+		require(_v < 2);
+		count += _v;
+	}
+	function check() public view {
+		assert(count < 3);
+	}
+}
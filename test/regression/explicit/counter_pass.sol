@@ -0,0 +1,20 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel
+// RUN: ./ecmodel --threads=2 --depth=4 --dfs | OutputCheck %s --comment=//
+// CHECK: No violations within 4 transactions.
+
+/*
+ * The counter saturates at 2, so no bounded search may violate the assertion.
+ */
+
+contract Contract {
+	uint8 count;
+	function incr() public {
+		if (count < 2) count += 1;
+	}
+	function check() public view {
+		assert(count < 3);
+	}
+}
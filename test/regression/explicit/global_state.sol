@@ -0,0 +1,30 @@
+// RUN: %solc %s --c-model --bundle A --global-state --output-dir=%t
+// RUN: cd %t
+// RUN: grep "SOL_GLOBAL sol_uint256_t g_Base_user_total;" cmodel.c
+// RUN: grep "SOL_GLOBAL struct Map_1 g_A_user_bal;" cmodel.c
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=2 --depth=3 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * Each state variable is hoisted into a global, including those inherited from
+ * Base. The transactions of each thread must still see their own state, and the
+ * violation must be reached through both the map and the inherited total.
+ */
+
+contract Base {
+	uint total;
+}
+
+contract A is Base {
+	mapping(address => uint) bal;
+	function deposit() public {
+		bal[msg.sender] += 1;
+		total += 1;
+	}
+	function check() public view {
+		assert(bal[msg.sender] < 2 || total < 2);
+	}
+}
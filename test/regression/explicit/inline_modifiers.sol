@@ -0,0 +1,25 @@
+// RUN: %solc %s --c-model --inline-modifiers --output-dir=%t
+// RUN: cd %t
+// RUN: grep "SOL_ALWAYS_INLINE void A_Method_1_f" cmodel.c
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=4 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * Ensures that an inlined modifier chain still runs each modifier, in order.
+ */
+
+contract A {
+	uint8 count;
+	modifier inc() {
+		count += 1;
+		_;
+	}
+	modifier chk() {
+		_;
+		assert(count < 3);
+	}
+	function f() public inc() chk() {}
+}
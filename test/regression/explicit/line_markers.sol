@@ -0,0 +1,27 @@
+// RUN: %solc %s --c-model --line-markers --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath -DCMAKE_CXX_FLAGS=--coverage -DCMAKE_EXE_LINKER_FLAGS=--coverage
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=4 --cex=cex.txt --return-0
+// RUN: ./icmodel --return-0 < cex.txt
+// RUN: gcov -o CMakeFiles/icmodel.dir/cmodel.cpp.gcda cmodel.cpp
+// RUN: cat line_markers.sol.gcov | OutputCheck %s --comment=//
+// CHECK: 3:\s+22:\s+count \+= _v;
+// CHECK: 1\*?:\s+25:\s+assert\(count < 3\);
+
+/*
+ * Ensures that each statement of cmodel.c is attributed to its Solidity line,
+ * so that coverage is reported against the contract. The counterexample
+ * increments the counter three times, and then fails the assertion.
+ */
+
+contract Contract {
+	uint8 count;
+	function incr(uint8 _v) public {
+		require(_v < 2);
+		count += _v;
+	}
+	function check() public view {
+		assert(count < 3);
+	}
+}
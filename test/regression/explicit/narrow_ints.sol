@@ -0,0 +1,20 @@
+// RUN: %solc %s --c-model --narrow-ints --output-dir=%t
+// RUN: cd %t
+// RUN: grep "sol_uint8_t user_mode" cmodel.c
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=2 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * The mode is only ever 0, 1 or 2, so it is stored in 8 bits. Reads must be
+ * widened to 256 bits, or else the sum wraps and the violation is missed.
+ */
+
+contract A {
+	uint256 mode;
+	function set() public { mode = 2; }
+	function reset() public { mode = 1; }
+	function check() public view { assert(mode + 254 < 256); }
+}
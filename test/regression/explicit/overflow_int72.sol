@@ -0,0 +1,18 @@
+// RUN: %solc %s --c-model --overflow-checks=all --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel
+// RUN: ./ecmodel --threads=1 --depth=2 --values=2 | OutputCheck %s --comment=//
+// CHECK: No violations within 2 transactions.
+
+/*
+ * The sum fits in an int72, and so must not be reported as an overflow. This
+ * ensures that signed bounds are correct for widths above 64 bits.
+ */
+
+contract A {
+	int72 s;
+	function f(int72 y) public {
+		s = y + 1000;
+	}
+}
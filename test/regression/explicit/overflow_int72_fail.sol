@@ -0,0 +1,20 @@
+// RUN: %solc %s --c-model --overflow-checks=all --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=2 --values=2 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * The sum exceeds the 64-bit range of the cstdint model, and so the overflow
+ * must still be reported for an int72.
+ */
+
+contract A {
+	int72 s;
+	function f(int72 y) public {
+		require(y > 0);
+		s = y + 9223372036854775807;
+	}
+}
@@ -0,0 +1,20 @@
+// RUN: %solc %s --c-model --overflow-checks=all --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=2 --values=2 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * The negation of the least int8 does not fit in an int8, and so must be
+ * reported as an overflow.
+ */
+
+contract A {
+	int8 t;
+	function f(int8 y) public {
+		t = -127 - y;
+		t = -t;
+	}
+}
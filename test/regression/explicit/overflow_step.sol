@@ -0,0 +1,30 @@
+// RUN: %solc %s --c-model --overflow-checks=all --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel
+// RUN: ./ecmodel --threads=1 --depth=2 --values=2 | OutputCheck %s --comment=//
+// CHECK: No violations within 2 transactions.
+
+/*
+ * Checked steps and negations must keep the semantics of ++, -- and unary -,
+ * including the old value returned by a postfix step.
+ */
+
+contract A {
+	uint8 s;
+	int8 t;
+	function f(uint8 y) public {
+		s = 253 + y;
+		uint8 old = s++;
+		assert(old == 253 + y && s == 254 + y);
+		old = s--;
+		assert(old == 254 + y && s == 253 + y);
+		assert(++s == 254 + y);
+		assert(--s == 253 + y);
+	}
+	function g(int8 y) public {
+		t = -127 + y;
+		t = -t;
+		assert(t == 127 - y);
+	}
+}
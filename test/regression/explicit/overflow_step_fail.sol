@@ -0,0 +1,20 @@
+// RUN: %solc %s --c-model --overflow-checks=all --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=2 --values=2 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * An increment past the range of a uint8 must be reported as an overflow, as
+ * with a compound assignment.
+ */
+
+contract A {
+	uint8 s;
+	function f(uint8 y) public {
+		s = 254 + y;
+		s++;
+	}
+}
@@ -0,0 +1,19 @@
+// RUN: %solc %s --c-model --shared-env --output-dir=%t
+// RUN: cd %t
+// RUN: grep "struct sol_env\*env" cmodel.c
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=4 --values=2 --cex=cex.txt --return-0 | OutputCheck %s --comment=//
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/*
+ * Ensures that methods read the block number and timestamp through the shared
+ * environment, and that the environment advances between transactions.
+ */
+
+contract A {
+	function g() public view {
+		assert(block.number < 6 || now < 6);
+	}
+}
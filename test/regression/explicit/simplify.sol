@@ -0,0 +1,29 @@
+// RUN: %solc %s --c-model --simplify --output-dir=%t
+// RUN: cd %t
+// RUN: cat cmodel.c | OutputCheck %s --comment=//
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel icmodel
+// RUN: ./ecmodel --threads=1 --depth=4 --cex=cex.txt --return-0
+// RUN: ./icmodel --return-0 < cex.txt 2>&1 | grep assert
+// CHECK-NOT: ==\(3\)
+// CHECK-L: {if(((self->user_count).v)<(5))
+
+/*
+ * Ensures that the branch with a constant condition is removed, and that the
+ * simplified model still reaches the violation.
+ */
+
+contract A {
+	uint8 count;
+	function incr() public {
+		if (1 + 1 == 3) {
+			count = 0;
+		}
+		else if (count < 5) {
+			count += 1;
+		}
+	}
+	function check() public view {
+		assert(count < 3);
+	}
+}
@@ -0,0 +1,28 @@
+// RUN: %solc %s --bundle A B --split-bundle --c-model --output-dir=%t
+// RUN: cd %t/A
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel
+// RUN: ./ecmodel --threads=1 --depth=4 --return-0 2>&1 | grep "Trace:"
+// RUN: cd %t/B
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make ecmodel
+// RUN: ./ecmodel --threads=1 --depth=4 | OutputCheck %s --comment=//
+// CHECK: No violations within 4 transactions.
+
+/*
+ * Ensures that each contract of a split bundle is emitted as its own model,
+ * and that each model is checked independently. Only A can violate its
+ * assertion.
+ */
+
+contract A {
+	uint8 count;
+	function incr() public { if (count < 5) count += 1; }
+	function check() public view { assert(count < 3); }
+}
+
+contract B {
+	uint8 count;
+	function incr() public { if (count < 2) count += 1; }
+	function check() public view { assert(count < 3); }
+}
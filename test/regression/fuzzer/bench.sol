@@ -0,0 +1,19 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake . -DCMAKE_CXX_COMPILER=clang++ -DCMAKE_C_COMPILER=clang -DSEA_PATH=%seapath -DBENCH_RUNS=1000
+// RUN: cmake --build . --target fuzz
+// RUN: cmake --build . --target bench | OutputCheck %s --comment=//
+// CHECK: /fuzztest: [0-9]+ execs/sec
+// CHECK: /fuzztest_fast: [0-9]+ execs/sec
+
+/*
+ * Regression test for the optimized fuzzer. Both the default and optimized
+ * fuzzers must replay the recorded corpus, and report their throughput.
+ */
+
+contract Contract {
+	uint256 counter;
+	function incr() public {
+		counter = counter + 1;
+	}
+}
@@ -0,0 +1,22 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: grep "^uint64_t sol_coverage_hash" %t/cmodel.c > %t/coverage.txt
+// RUN: OutputCheck %s --comment=// < %t/coverage.txt
+// RUN: ! grep -q "blocknum\|timestamp\|g_literal_address" %t/coverage.txt
+// CHECK-L: uint64_t sol_coverage_hash(struct A*contract_0)
+
+/*
+ * The fuzzer treats each novel coverage hash as new coverage. The block number,
+ * timestamp and literal addresses change without reaching new behaviour, so
+ * they must not be folded into the coverage hash.
+ */
+
+contract A {
+	address owner = address(5);
+	uint last;
+	mapping(address => uint) seen;
+	function f() public {
+		last = block.number;
+		seen[msg.sender] = block.timestamp;
+		if (msg.sender == owner) last = 0;
+	}
+}
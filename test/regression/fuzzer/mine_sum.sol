@@ -0,0 +1,21 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake . -DCMAKE_CXX_COMPILER=clang++ -DCMAKE_C_COMPILER=clang -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: cmake --build . --target fuzz
+// RUN: cmake --build . --target mine
+// RUN: cat invariants.h | OutputCheck %s --comment=//
+// CHECK-L: ((contract_0)->user_total).v == (
+
+/*
+ * Regression test for invariant mining. The total is always the sum of all
+ * balances, so the miner should relate it to the sum of the map entries.
+ */
+
+contract Contract {
+	mapping(address => uint256) balances;
+	uint256 total;
+	function mint(uint8 _v) public {
+		balances[msg.sender] += _v;
+		total += _v;
+	}
+}
@@ -0,0 +1,18 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DSEA_PATH=%seapath
+// RUN: make icmodel
+// RUN: echo 0 0 1 1 1 2 0 305419896 8538902395511793176354910265567789615811370268742294445867884604459952327117 22068622680911700764321525266852476815069367068878736168591169089364878371621 0 | ./icmodel --return-0 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+
+/**
+ * Ensures that bytesN is right-padded by abi.encode, but not by
+ * abi.encodePacked. The trace passes bytes4(0x12345678) along with the digest
+ * of each encoding, as computed by the EVM.
+ */
+
+contract A {
+	function check(bytes4 b, bytes32 h, bytes32 hp) public pure {
+		assert(keccak256(abi.encode(b)) != h || keccak256(abi.encodePacked(b)) != hp);
+	}
+}
@@ -0,0 +1,20 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DSEA_PATH=%seapath
+// RUN: make icmodel
+// RUN: echo 0 0 1 1 1 0 2 1 0 2 0 | ./icmodel --return-0 2>&1 | OutputCheck %s --comment=//
+// CHECK-NOT: assert
+// CHECK: Call successful
+
+/*
+ * Address literals are decoded from a permutation, so any choice of inputs
+ * maps the literals to distinct addresses.
+ */
+
+contract A {
+    function f() public view {
+        assert(address(5) != address(6));
+        assert(address(6) != address(7));
+        assert(address(5) != address(7));
+    }
+}
@@ -0,0 +1,20 @@
+// RUN: %solc %s --reps=1 --lockstep-time=off --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DSEA_PATH=%seapath -DCMAKE_CXX_FLAGS=-DMC_LOG_LEVEL=1
+// RUN: make icmodel
+// RUN: echo 3 0 0 2 1 0 0 2 | ./icmodel --return-0 2>&1 | OutputCheck %s --comment=//
+// CHECK: Select value
+// CHECK: Entering transaction loop
+// CHECK-NOT: Calling
+// CHECK: assert
+
+/**
+ * Ensures that logs above MC_LOG_LEVEL are compiled out. Phases are still
+ * logged at level 1, but calls are not, and each value has a generic prompt.
+ */
+
+contract A {
+	function f() public view {
+		assert(msg.sender == address(2) || address(this) == address(2));
+	}
+}
@@ -0,0 +1,26 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DSEA_PATH=%seapath
+// RUN: make icmodel
+// RUN: echo 5 9 0 1 0 0 77777 1 0 0 5 1 0 0 98765432101234 1 0 1 0 > cex.txt
+// RUN: ./icmodel --minimize=cex.txt 2>&1 | OutputCheck %s --comment=//
+// CHECK: 0 0 0 1 0 0 101 1 0 1
+// CHECK: assert
+// CHECK: 2 transactions
+
+/**
+ * Ensures that a failing trace is reduced to its fewest transactions, with all
+ * values moved as close to zero as possible.
+ */
+
+contract A {
+    uint256 x;
+
+    function set(uint256 v) public {
+        x = v;
+    }
+
+    function check() public view {
+        assert(x <= 100);
+    }
+}
@@ -0,0 +1,17 @@
+// RUN: %solc %s --reps=1 --lockstep-time=off --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DSEA_PATH=%seapath | grep "prebuilt runtime found"
+// RUN: make icmodel
+// RUN: echo 3 0 0 2 1 0 0 2 | ./icmodel --return-0 --count-transactions 2>&1 | OutputCheck %s --comment=//
+// CHECK: assert
+// CHECK: Transaction Count: 1
+
+/**
+ * Ensures that the model links against the runtime installed with solc.
+ */
+
+contract A {
+	function f() public view {
+		assert(msg.sender == address(2) || address(this) == address(2));
+	}
+}
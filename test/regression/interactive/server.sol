@@ -0,0 +1,27 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DSEA_PATH=%seapath
+// RUN: make icmodel
+// RUN: printf '0 0 0 1 0 0 7 1 0 1 0\n0 0 0 1 0 0 3 1 0 1 0\n0 0 0 1 0 0 12\n0 0 0 1\n' | ./icmodel --server 2>&1 | OutputCheck %s --comment=//
+// CHECK: 0 assert 2
+// CHECK: 1 pass 2
+// CHECK: 2 require 1
+// CHECK: 3 incomplete 1
+
+/**
+ * Ensures that server mode resets the model between traces, and reports the
+ * outcome of each trace.
+ */
+
+contract A {
+    uint256 x;
+
+    function set(uint256 v) public {
+        require(v < 10);
+        x = v;
+    }
+
+    function check() public view {
+        assert(x != 7);
+    }
+}
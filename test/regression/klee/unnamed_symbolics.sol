@@ -0,0 +1,17 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake . -DCMAKE_CXX_COMPILER=clang++ -DCMAKE_C_COMPILER=clang -DKLEE_PATH=%kleepath -DKLEE_LIB=%kleelib
+// RUN: make symbex 2>&1 | OutputCheck %s --comment=//
+// CHECK: ASSERTION FAIL
+
+/*
+ * KLEE builds compile out the description of each value, so each symbolic
+ * value must still be given a name. The assertion is only reachable through
+ * the arguments of f.
+ */
+
+contract A {
+    function f(uint8 a, uint8 b) public pure {
+        assert(a != 3 || b != 7);
+    }
+}
@@ -0,0 +1,35 @@
+/**
+ * A malloc counter for bench_alloc.py. When preloaded, each call to malloc is
+ * counted, and the total is written to the file named by MALLOC_COUNT_FILE (or
+ * to stderr) on exit. Operator new is implemented by malloc, so this also
+ * counts the allocations of C++ containers.
+ *
+ * @date 2020
+ */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned long long g_calls = 0;
+static void* (*g_real_malloc)(size_t) = NULL;
+
+void* malloc(size_t _size)
+{
+    if (!g_real_malloc)
+    {
+        g_real_malloc = (void* (*)(size_t))(dlsym(RTLD_NEXT, "malloc"));
+    }
+    __atomic_add_fetch(&g_calls, 1, __ATOMIC_RELAXED);
+    return g_real_malloc(_size);
+}
+
+__attribute__((destructor)) static void malloc_count_report(void)
+{
+    const char* path = getenv("MALLOC_COUNT_FILE");
+    FILE* out = (path ? fopen(path, "w") : stderr);
+    if (!out) return;
+    fprintf(out, "%llu\n", g_calls);
+    if (out != stderr) fclose(out);
+}
@@ -0,0 +1,20 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DINT_MODEL:STRING=USE_STDINT -DSEA_PATH=%seapath
+// RUN: make rcmodel
+// RUN: ./rcmodel --threads=2 --runs=10000 | OutputCheck %s --comment=//
+// CHECK: No violations within 10000 runs.
+
+/*
+ * The counter saturates at 2, so no run may violate the assertion.
+ */
+
+contract Contract {
+	uint8 count;
+	function incr() public {
+		if (count < 2) count += 1;
+	}
+	function check() public view {
+		assert(count < 3);
+	}
+}
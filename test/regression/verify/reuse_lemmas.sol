@@ -0,0 +1,29 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: mkdir -p fake_sea
+// RUN: printf '#!/bin/sh\necho "args: $*"\necho unsat\necho "Function: main"\necho "main@_bb1: (and (>= main@contract_0.user_count.0 0) (<= main@contract_0.user_count.0 10) (= main@tmp_3 1))"\n' > fake_sea/sea
+// RUN: chmod +x fake_sea/sea
+// RUN: cmake -DSEA_PATH=%t/fake_sea
+// RUN: make verify | grep "Stored lemmas for the next run"
+// RUN: grep -F "((((__int128)(((contract_0)->user_count).v)) >= 0) && (((__int128)(((contract_0)->user_count).v)) <= 10))" sea_invars/sea_lemmas.h
+// RUN: cc -fsyntax-only -DMC_USE_STDINT -DMC_USE_SEA_LEMMAS -I. -Isea_invars cmodel.c
+// RUN: echo "// edit" >> primitive.h
+// RUN: make verify | OutputCheck %s --comment=//
+// CHECK: Assuming the lemmas of
+// CHECK: -DMC_USE_SEA_LEMMAS
+// CHECK: ^unsat$
+
+/*
+ * Ensures that the invariants of a safe run are translated into lemmas over the
+ * contract state, that the lemmas are valid C, and that the next run of verify
+ * assumes and checks them. The variable tmp_3 has no counterpart in the model,
+ * so its conjunct is dropped. Seahorn is replaced by a script which reports a
+ * fixed invariant.
+ */
+
+contract A {
+	uint8 count;
+	function incr() public {
+		if (count < 10) count += 1;
+	}
+}
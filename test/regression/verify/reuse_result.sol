@@ -0,0 +1,24 @@
+// RUN: %solc %s --c-model --output-dir=%t
+// RUN: cd %t
+// RUN: cmake -DSEA_PATH=%seapath
+// RUN: make verify | OutputCheck %s --comment=//
+// RUN: make verify | grep "reusing result"
+// RUN: echo "// edit" >> primitive.h
+// RUN: make verify | OutputCheck %s --comment=//
+// CHECK-NOT: reusing result
+// CHECK: ^unsat$
+
+/*
+ * Ensures that the result of verify is written to stdout, and that it is only
+ * reused while the model and its headers are unchanged.
+ */
+
+contract A {
+	uint8 count;
+	function incr() public {
+		if (count < 10) count += 1;
+	}
+	function check() public view {
+		assert(count <= 10);
+	}
+}